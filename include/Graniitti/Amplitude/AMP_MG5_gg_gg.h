@@ -66,10 +66,17 @@ class AMP_MG5_gg_gg {
   // Private functions to calculate the matrix element for all subprocesses
   // Calculate wavefunctions
   void                 calculate_wavefunctions(const int perm[], const int hel[]);
+  // Each external leg has only two helicity states, so both variants are
+  // evaluated once per phase-space point and re-used over all 16 combinations
+  void                             precompute_external(const int perm[]);
+  alignas(32) std::complex<double> wext[nexternal][2][6];
   static const int     nwavefuncs = 7;
-  std::complex<double> w[nwavefuncs][18];
+  // Vector/fermion wavefunctions use components [0..5] only; 18 is needed
+  // just for tensor (txxxxx) legs, which this process has none of. The
+  // narrow rows keep the whole table inside L1 during the helicity loop.
+  alignas(32) std::complex<double> w[nwavefuncs][6];
   static const int     namplitudes = 6;
-  std::complex<double> amp[namplitudes];
+  alignas(32) std::complex<double> amp[namplitudes];
   double               matrix_1_gg_gg();
 
   // Store the matrix element value from sigmaKin
@@ -65,11 +65,22 @@ class AMP_MG5_gg_ggg {
  private:
   // Private functions to calculate the matrix element for all subprocesses
   // Calculate wavefunctions
-  void                 calculate_wavefunctions(const int perm[], const int hel[]);
-  static const int     nwavefuncs = 33;
-  std::complex<double> w[nwavefuncs][18];
+  void calculate_wavefunctions(const int perm[], const int hel[]);
+  // Split evaluation: the shared part does not depend on the helicity of
+  // the last external leg and is re-used across each +-1 helicity pair
+  void                 calculate_wavefunctions_shared(const int perm[], const int hel[]);
+  void                 calculate_wavefunctions_last(const int perm[], int hel4);
+  // Each external leg has only two helicity states, so both variants are
+  // evaluated once per phase-space point and re-used over all 32 combinations
+  void                             precompute_external(const int perm[]);
+  alignas(32) std::complex<double> wext[nexternal][2][6];
+  static const int                 nwavefuncs = 33;
+  // Vector/fermion wavefunctions use components [0..5] only; 18 is needed
+  // just for tensor (txxxxx) legs, which this process has none of. The
+  // narrow rows keep the whole table inside L1 during the helicity loop.
+  alignas(32) std::complex<double> w[nwavefuncs][6];
   static const int     namplitudes = 45;
-  std::complex<double> amp[namplitudes];
+  alignas(32) std::complex<double> amp[namplitudes];
   double               matrix_1_gg_ggg();
 
   // Store the matrix element value from sigmaKin
@@ -84,8 +95,14 @@ class AMP_MG5_gg_ggg {
   // vector with external particle masses
   vector<double> mME;
 
+  // final state momenta scratch, re-used between events
+  std::vector<gra::M4Vec> pf;
+
   // vector with momenta (to be changed each event)
   vector<double *> p;
+  // Contiguous momentum storage [E,px,py,pz] per external leg behind p,
+  // overwritten in place each event (no per-call stack VLA)
+  double pbuf[nexternal][4];
   // Initial particle ids
   int id1, id2;
 };
@@ -67,9 +67,12 @@ class AMP_MG5_yy_ww {
   // Calculate wavefunctions
   void                 calculate_wavefunctions(const int perm[], const int hel[]);
   static const int     nwavefuncs = 6;
-  std::complex<double> w[nwavefuncs][18];
+  // Vector/fermion wavefunctions use components [0..5] only; 18 is needed
+  // just for tensor (txxxxx) legs, which this process has none of. The
+  // narrow rows keep the whole table inside L1 during the helicity loop.
+  alignas(32) std::complex<double> w[nwavefuncs][6];
   static const int     namplitudes = 3;
-  std::complex<double> amp[namplitudes];
+  alignas(32) std::complex<double> amp[namplitudes];
   double               matrix_1_aa_wpwm();
 
   // Store the matrix element value from sigmaKin
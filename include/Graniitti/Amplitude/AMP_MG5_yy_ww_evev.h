@@ -71,9 +71,12 @@ class AMP_MG5_yy_ww_evev {
   // Calculate wavefunctions
   void                 calculate_wavefunctions(const int perm[], const int hel[]);
   static const int     nwavefuncs = 10;
-  std::complex<double> w[nwavefuncs][18];
+  // Vector/fermion wavefunctions use components [0..5] only; 18 is needed
+  // just for tensor (txxxxx) legs, which this process has none of. The
+  // narrow rows keep the whole table inside L1 during the helicity loop.
+  alignas(32) std::complex<double> w[nwavefuncs][6];
   static const int     namplitudes = 3;
-  std::complex<double> amp[namplitudes];
+  alignas(32) std::complex<double> amp[namplitudes];
   double               matrix_1_aa_wpwm_wp_epve_wm_emvex();
 
   // Store the matrix element value from sigmaKin
@@ -120,6 +120,19 @@ void VVVV4_0(std::complex<double> V1[], std::complex<double> V2[], std::complex<
 void VVVV1_0(std::complex<double> V1[], std::complex<double> V2[], std::complex<double> V3[],
              std::complex<double> V4[], std::complex<double> COUP, std::complex<double>& vertex);
 
+// Fused evaluation of the VVVV1/VVVV3/VVVV4 P0_1 vertices on one
+// (V2, V3, V4) triplet: momentum prefix, propagator denominator and the
+// three dot products are shared between the variants
+void VVVV134P0_1(std::complex<double> V2[], std::complex<double> V3[], std::complex<double> V4[],
+                 std::complex<double> COUP, double M1, double W1, std::complex<double> V1A[],
+                 std::complex<double> V1B[], std::complex<double> V1C[]);
+
+// Fused evaluation of the VVVV1/VVVV3/VVVV4 vertex amplitudes on one
+// (V1, V2, V3, V4) quadruplet, sharing the six dot products
+void VVVV134_0(std::complex<double> V1[], std::complex<double> V2[], std::complex<double> V3[],
+               std::complex<double> V4[], std::complex<double> COUP, std::complex<double>& vertex1,
+               std::complex<double>& vertex3, std::complex<double>& vertex4);
+
 }  // end namespace MG5_sm
 
 #endif  // HelAmps_sm_H
\ No newline at end of file
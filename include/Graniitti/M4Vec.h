@@ -20,6 +20,7 @@
 #ifndef M4VEC_H
 #define M4VEC_H
 
+#include <array>
 #include <complex>
 #include <iostream>
 #include <vector>
@@ -114,6 +115,9 @@ class M4Vec {
   double Z() const { return k[Z_]; }
   double T() const { return k[E_]; }
 
+  // Raw contiguous storage in [E,px,py,pz] order, for bulk momentum staging
+  const double *data() const { return k.data(); }
+
   // Return 3-vector
   std::vector<double> P3() const { return {k[X_], k[Y_], k[Z_]}; }
 
@@ -318,8 +322,8 @@ class M4Vec {
 
   // Safe sqrt
   double msqrt(double x) const { return std::sqrt(std::max(0.0, x)); }
-  // 4-vector
-  std::vector<double> k;
+  // 4-vector, contiguous in-object storage (no heap allocation per vector)
+  std::array<double, 4> k;
 };
 
 }  // namespace gra
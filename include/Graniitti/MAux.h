@@ -11,6 +11,7 @@
 #include <unistd.h>
 
 #include <complex>
+#include <future>
 #include <mutex>
 #include <random>
 #include <regex>
@@ -33,6 +34,7 @@
 #include <Eigen/Dense>
 
 // Libraries
+#include "json.hpp"
 #include "rang.hpp"
 
 namespace gra {
@@ -109,6 +111,7 @@ std::string GetTimeStamp(const std::string format = "%d-%m-%Y_%H-%M-%S");
 void        PrintArgv(int argc, char *argv[]);
 void        AutoDownloadLHAPDF(const std::string pdfname);
 std::string ExecCommand(const std::string &cmd);
+std::string ExecArgv(const std::vector<std::string> &args);
 std::string GetExecutablePath();
 std::string GetBasePath(std::size_t level);
 
@@ -120,6 +123,8 @@ std::experimental::filesystem::file_status{});
 */
 
 std::uintmax_t GetFileSize(const std::string &filename);
+double         GetPeakMemory();
+double         GetResidentMemory();
 void           GetProcessMemory(double &peak_use, double &resident_use);
 void           GetDiskUsage(const std::string &path, int64_t &size, int64_t &free, int64_t &used);
 unsigned long long TotalSystemMemory();
@@ -143,6 +148,9 @@ void ReadCSV(const std::string &inputfile, std::vector<std::vector<std::string>>
 // Input processing
 std::string GetInputData(const std::string &inputfile);
 
+// Parsed JSON input, cached per file
+const nlohmann::json &GetInputJSON(const std::string &inputfile);
+
 bool IsIntegerDigits(const std::string &str);
 
 // Trim extra spaces of a string
@@ -218,7 +226,12 @@ void PrintBar(std::string str, unsigned int N = 74);
 void CreateDirectory(std::string fullpath);
 
 // Version information
-void CheckUpdate();
+//
+// CheckUpdate() blocks; alternatively fire the network fetch early with
+// FireCheckUpdate() and join it later with a bounded wait
+void                            CheckUpdate();
+std::shared_future<std::string> FireCheckUpdate();
+void JoinCheckUpdate(std::shared_future<std::string> future, int timeout_ms = 10000);
 void CreateVersionJSON();
 
 double      GetVersion();
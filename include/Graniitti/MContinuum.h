@@ -7,7 +7,9 @@
 #define MCONTINUUM_H
 
 // C++
+#include <array>
 #include <complex>
+#include <span>
 #include <vector>
 
 // Own
@@ -21,6 +23,30 @@
 #include "HepMC3/GenEvent.h"
 
 namespace gra {
+
+// Structure-of-Arrays storage for a collection of 4-momenta.
+// Per-component loops over this layout are contiguous and auto-vectorize,
+// unlike gathers from an array of M4Vec objects. Storage is fixed inline
+// (capacity bounded by the maximum central system multiplicity), so there
+// is no heap backing store and no pointer indirection per access.
+struct M4VecSoA {
+  static constexpr std::size_t MAXN = 8;
+
+  std::array<double, MAXN> px{};
+  std::array<double, MAXN> py{};
+  std::array<double, MAXN> pz{};
+  std::array<double, MAXN> e{};
+
+  void        resize(std::size_t m) { n = m; }
+  std::size_t size() const { return n; }
+
+  // Gather a single element back to an M4Vec when object semantics are needed
+  M4Vec Get(std::size_t i) const { return M4Vec(px[i], py[i], pz[i], e[i]); }
+
+ private:
+  std::size_t n = 0;
+};
+
 class MContinuum : public MProcess {
  public:
   MContinuum();
@@ -29,10 +55,13 @@ class MContinuum : public MProcess {
 
   void post_Constructor();
 
-  double operator()(const std::vector<double> &randvec, AuxIntData &aux) {
+  // Maximum central system multiplicity of the B-linear system tables
+  static constexpr unsigned int BLS_KFMAX = 8;
+
+  double operator()(std::span<const double> randvec, AuxIntData &aux) {
     return EventWeight(randvec, aux);
   }
-  double EventWeight(const std::vector<double> &randvec, AuxIntData &aux);
+  double EventWeight(std::span<const double> randvec, AuxIntData &aux);
   bool   EventRecord(HepMC3::GenEvent &evt);
   void   PrintInit(bool silent) const;
 
@@ -42,19 +71,52 @@ class MContinuum : public MProcess {
   bool FiducialCuts() const;
 
   // 3*N-4 dimensional phase space, 2->N
-  bool BNRandomKin(unsigned int Nf, const std::vector<double> &randvec);
+  bool BNRandomKin(unsigned int Nf, std::span<const double> randvec);
   bool BNBuildKin(unsigned int Nf, double pt1, double pt2, double phi1, double phi2,
                   const std::vector<double> &kt, const std::vector<double> &phi,
                   const std::vector<double> &y, double m1, double m2);
 
-  void BLinearSystem(std::vector<M4Vec> &p, const std::vector<M4Vec> &q, const M4Vec &p1f,
+  // Solves the px,py components of the Kf central states and writes them
+  // in-place to p[0...Kf-1] (typically the pfinal slots)
+  void BLinearSystem(M4Vec *p, unsigned int Kf, const M4VecSoA &q, const M4Vec &p1f,
                      const M4Vec &p2f) const;
 
+  // Kf-specialized kernel behind BLinearSystem: the compile-time trip
+  // count lets the compiler fully unroll the inner products with the
+  // system matrix constants folded in
+  template <unsigned int KF>
+  void BLinearSystemT(M4Vec *p, const M4VecSoA &q, const M4Vec &p1f, const M4Vec &p2f) const;
+
   double BNIntegralVolume() const;
   double BNPhaseSpaceWeight() const;
 
-  // Auxialary (kt) vectors
-  std::vector<M4Vec> pkt_;
+  // Auxialary (kt) vectors in SoA layout (only px,py are non-zero)
+  M4VecSoA pkt_;
+
+  // Product of the sampled |kt_i|, cached when pkt_ is filled so the
+  // phase-space weight does not re-derive the magnitudes by sqrt
+  double kt_prod_ = 1.0;
+
+  // True when every first-level leg has (numerically) zero width: their
+  // offshell masses are then fixed constants preset in post_Constructor
+  // and the per-event sampling loop is skipped
+  bool zero_width_legs_ = false;
+
+  // Run constants folded once in post_Constructor (Nf and the generation
+  // cuts are fixed for the whole integration)
+  double log_fwd_pt_min_   = 0.0;  // log(forward_pt_min + eps)
+  double log_fwd_pt_max_   = 0.0;  // log(forward_pt_max)
+  double log_fwd_pt_range_ = 0.0;  // log_fwd_pt_max_ - log_fwd_pt_min_
+  double kt_span_          = 0.0;  // kt_max - kt_min
+  double rap_span_         = 0.0;  // rap_max - rap_min
+  double kt_volume_        = 0.0;  // [kt] x [phi] x [y] volume factor
+  double ps_norm_          = 0.0;  // 1 / (2^{2(Nf-2)} (2pi)^{3Nf-4})
+
+  // Per-event scratch (threads own their process copies, so no sharing)
+  std::vector<double> ktbuf_;
+  std::vector<double> phibuf_;
+  std::vector<double> ybuf_;
+  std::vector<double> mbuf_;
 };
 
 }  // namespace gra
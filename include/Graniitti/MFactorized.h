@@ -9,6 +9,7 @@
 // C++
 #include <complex>
 #include <random>
+#include <span>
 #include <vector>
 
 // Own
@@ -30,10 +31,10 @@ class MFactorized : public MProcess {
 
   void post_Constructor();
 
-  double operator()(const std::vector<double> &randvec, AuxIntData &aux) {
+  double operator()(std::span<const double> randvec, AuxIntData &aux) {
     return EventWeight(randvec, aux);
   }
-  double EventWeight(const std::vector<double> &randvec, AuxIntData &aux);
+  double EventWeight(std::span<const double> randvec, AuxIntData &aux);
   bool   EventRecord(HepMC3::GenEvent &evt);
   void   PrintInit(bool silent) const;
 
@@ -43,7 +44,7 @@ class MFactorized : public MProcess {
   bool FiducialCuts() const;
 
   // 5+1-Dim phase space, 2->3
-  bool B51RandomKin(const std::vector<double> &randvec);
+  bool B51RandomKin(std::span<const double> randvec);
   bool B51BuildKin(double pt1, double pt2, double phi1, double phi2, double yX, double m2X,
                    double m1, double m2);
   void B51RecordEvent(HepMC3::GenEvent &evt);
@@ -51,11 +52,44 @@ class MFactorized : public MProcess {
   double B51IntegralVolume() const;
   double B51PhaseSpaceWeight() const;
 
+  // Central system phase space generators behind psgen_, uniform signature
+  gra::kinematics::MCW PS2(double M0, const std::vector<double> &masses,
+                           std::vector<M4Vec> &products, bool UNWEIGHT);
+  gra::kinematics::MCW PS3(double M0, const std::vector<double> &masses,
+                           std::vector<M4Vec> &products, bool UNWEIGHT);
+  gra::kinematics::MCW PSN(double M0, const std::vector<double> &masses,
+                           std::vector<M4Vec> &products, bool UNWEIGHT);
+
+  // Generator resolved once in post_Constructor (the decay topology is
+  // fixed after SetProcess); nullptr when the central system does not decay
+  gra::kinematics::MCW (MFactorized::*psgen_)(double, const std::vector<double> &,
+                                              std::vector<M4Vec> &, bool) = nullptr;
+
   void DecayWidthPS(double &exact) const;
 
   // Dynamic sampling boundaries based on resonance position and width
   double M_MIN = 0.0;
   double M_MAX = 0.0;
+
+  // Run constants folded once in post_Constructor (generation cuts are
+  // fixed for the whole integration)
+  double log_fwd_pt_min_   = 0.0;  // log(forward_pt_min + eps)
+  double log_fwd_pt_range_ = 0.0;  // log(forward_pt_max) - log_fwd_pt_min_
+  double rap_span_         = 0.0;  // Y_max - Y_min
+  double w_norm_           = 0.0;  // (1/S_factor) x GeV2barn / MollerFlux
+
+  // True when every first-level leg has (numerically) zero width: their
+  // offshell masses are then fixed constants preset in post_Constructor
+  // and the per-event mass trial loop collapses to one window check
+  bool   zero_width_legs_ = false;
+  double legs_m_sum_      = 0.0;  // sum of the fixed leg masses
+
+  // Per-event scratch (threads own their process copies, so no sharing)
+  std::vector<double>      mbuf_;
+  std::vector<double>      rbuf_;
+  std::vector<double>      massbuf_;
+  std::vector<M4Vec>       productbuf_;
+  std::vector<std::size_t> indbuf_;
 };
 
 }  // namespace gra
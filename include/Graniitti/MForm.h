@@ -56,6 +56,15 @@ extern std::string F2;
 extern std::string EM;
 extern std::string QED_alpha;
 
+// Proton EM form factors (G_E, G_M) resolved from the EM string once in
+// ReadParameters, so per-call evaluation skips the string dispatch
+extern double (*G_E_fn)(double Q2);
+extern double (*G_M_fn)(double Q2);
+
+// F2 structure function model resolved from the F2 string the same way
+enum class F2MODEL { DL, CKMT };
+extern F2MODEL F2_model;
+
 void        ReadParameters(const std::string& modelfile);
 extern bool initialized;
 }  // namespace PARAM_STRUCTURE
@@ -83,8 +92,11 @@ namespace form {
 gra::PARAM_RES ReadResonance(const std::string& resparam_str, MRandom& rng);
 
 // Regge signature
-std::complex<double> ReggeEta(double alpha_t, double sigma);
-std::complex<double> ReggeEtaLinear(double t, double alpha_t0, double ap, double sigma);
+// (pure: results depend only on the scalar arguments, which lets the
+// compiler merge duplicate calls inside amplitude loops)
+__attribute__((pure)) std::complex<double> ReggeEta(double alpha_t, double sigma);
+__attribute__((pure)) std::complex<double> ReggeEtaLinear(double t, double alpha_t0, double ap,
+                                                          double sigma);
 
 // Proton form factor, elastic and inelastic
 double S3F(double t);
@@ -106,6 +118,7 @@ double DZFlux(double x);
 // Coherent gamma flux
 double F1(double Q2);
 double F2(double Q2);
+std::pair<double, double> F1F2(double Q2);  // {F1, F2} with shared (G_E, G_M)
 double G_M(double Q2);
 double G_E(double Q2);
 
@@ -125,10 +138,13 @@ double deltaBWxsec(double shat, double M0, double Gamma);
 double deltaBWamp(double shat, double M0, double Gamma);
 
 std::complex<double> CBW(const gra::LORENTZSCALAR& lts, const gra::PARAM_RES& resonance);
-std::complex<double> CBW_FW(double m2, double M0, double Gamma);
-std::complex<double> CBW_RW(double m2, double M0, double Gamma);
-std::complex<double> CBW_BF(double m2, double M0, double Gamma, int J, double mA, double mB);
-std::complex<double> CBW_JR(double m2, double M0, double Gamma, double J);
+__attribute__((pure)) std::complex<double> CBW_FW(double m2, double M0, double Gamma);
+__attribute__((pure)) std::complex<double> CBW_RW(double m2, double M0, double Gamma);
+__attribute__((pure)) std::complex<double> CBW_BF(double m2, double M0, double Gamma, int J,
+                                                  double mA, double mB);
+// N.B. not pure: updates the barrier-factor cache on the resonance
+std::complex<double> CBW_BF(double m2, const gra::PARAM_RES& resonance, double mA, double mB);
+__attribute__((pure)) std::complex<double> CBW_JR(double m2, double M0, double Gamma, double J);
 
 }  // namespace form
 }  // namespace gra
@@ -30,6 +30,17 @@ extern double      Gamma0;    // Monopolium width
 extern std::string coupling;  // Coupling scenarios
 extern int         gn;        // Monopole charge n = 1,2,3,...
 
+// Dirac magnetic coupling g = 2*pi*gn/e and its powers,
+// evaluated once in ReadParameters
+extern double g;
+extern double g2;
+extern double g4;
+
+// Coupling scheme resolved from the string once in ReadParameters;
+// UNKNOWN is rejected inside the amplitude kernels as before
+enum class COUPLING { UNKNOWN, DIRAC, BETA_DIRAC };
+extern COUPLING coupling_mode;
+
 double EnergyMP(double n);
 double GammaMP(double n, double alpha_g);
 double PsiMP(double n);
@@ -7,7 +7,10 @@
 #define MH1_H
 
 // C++
+#include <algorithm>
 #include <complex>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 #include "json.hpp"
@@ -40,6 +43,16 @@ struct compare_bin_edges {
 template <class T>
 class MH1 {
  public:
+  // Bin count storage type. 32-bit by default: per-bin counts fit easily
+  // in practice (weights/weights2 carry the precise weighted answer) and
+  // halving the count metadata keeps more histograms cache-resident in
+  // multi-observable runs. Fill saturates at the maximum instead of
+  // wrapping; define GRA_MH1_WIDE_COUNTS to restore 64-bit counts.
+#ifdef GRA_MH1_WIDE_COUNTS
+  using count_t = long long int;
+#else
+  using count_t = int32_t;
+#endif
   MH1(int xbins, double xmin, double xmax, std::string namestr = "noname");
   MH1(int xbins, std::string namestr = "noname");
   MH1(std::vector<std::vector<double>> edges, std::string namestr = "noname");
@@ -49,6 +62,7 @@ class MH1 {
 
   void Fill(double xvalue);
   void Fill(double xvalue, T weight);
+  void FillN(const std::vector<double> &xvalues, const std::vector<T> &wvalues);
   void Clear();
 
   void VectorOutput(std::vector<std::vector<double>> &bins,
@@ -63,11 +77,20 @@ class MH1 {
 
   // Probability density
   std::vector<double> GetProbDensity() const {
-    double sum = 0;
-    for (std::size_t i = 0; i < weights.size(); ++i) { sum += GetPositiveDefinite(i); }
+    // Single pass: evaluate each positive definite value once, then
+    // normalize in place with a reciprocal multiply (no second sweep of
+    // |w| evaluations, no per-bin divide)
     std::vector<double> p(weights.size(), 0.0);
+    double              sum = 0;
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+      p[i] = GetPositiveDefinite(i);
+      sum += p[i];
+    }
     if (sum > 0) {
-      for (std::size_t i = 0; i < weights.size(); ++i) { p[i] = GetPositiveDefinite(i) / sum; }
+      const double inv = 1.0 / sum;
+      for (std::size_t i = 0; i < weights.size(); ++i) { p[i] *= inv; }
+    } else {
+      std::fill(p.begin(), p.end(), 0.0);
     }
     return p;
   }
@@ -75,7 +98,24 @@ class MH1 {
   // Get full histogram data
   std::vector<T>             GetWeights() const { return weights; }
   std::vector<T>             GetWeights2() const { return weights2; }
-  std::vector<long long int> GetCounts() const { return counts; }
+  std::vector<long long int> GetCounts() const {
+    return std::vector<long long int>(counts.begin(), counts.end());  // widening copy
+  }
+
+  // Deinterleaved (SoA) views of the bin weights. Analysis which needs
+  // only the real or imaginary component reads a contiguous double array
+  // at half the bandwidth of striding over the complex storage.
+  // For T = double these reduce to a copy resp. zeros.
+  std::vector<double> GetWeightsRe() const {
+    std::vector<double> re(weights.size(), 0.0);
+    for (std::size_t i = 0; i < weights.size(); ++i) { re[i] = std::real(weights[i]); }
+    return re;
+  }
+  std::vector<double> GetWeightsIm() const {
+    std::vector<double> im(weights.size(), 0.0);
+    for (std::size_t i = 0; i < weights.size(); ++i) { im[i] = std::imag(weights[i]); }
+    return im;
+  }
 
   void GetXPositiveDefinite(std::valarray<double> &x, std::valarray<double> &y) const;
 
@@ -95,7 +135,7 @@ class MH1 {
   double        GetdOdXError(int idx) const;
 
   double GetBinXVal(int idx, int boundary = 0) const;
-  void   GetBinIdx(double xvalue, int &idx);
+  int    GetBinIdx(double xvalue) const;
   void   Print(double width = 1.25) const;  // default argument
 
   void ResetBounds(int xbins);
@@ -109,6 +149,7 @@ class MH1 {
           "MH1::SetLogX: Error: Minimum boundary XMIN = " + std::to_string(XMIN) + " < 0");
     }
     LOGX = true;
+    BuildBinCache();
   }
 
   // Number of bins
@@ -131,14 +172,11 @@ class MH1 {
     h.overflow  = this->overflow + rhs.overflow;
     h.nanflow   = this->nanflow + rhs.nanflow;
 
-    // DATA
-    h.weights  = this->weights;
-    h.weights2 = this->weights2;
-    h.counts   = this->counts;
-    for (std::size_t i = 0; i < h.weights.size(); ++i) {
-      h.weights[i] += rhs.weights[i];
-      h.weights2[i] += rhs.weights2[i];
-      h.counts[i] += rhs.counts[i];
+    // DATA (single fused pass: read lhs + rhs, write h; no copy-then-update)
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+      h.weights[i]  = weights[i] + rhs.weights[i];
+      h.weights2[i] = weights2[i] + rhs.weights2[i];
+      h.counts[i]   = counts[i] + rhs.counts[i];
     }
     return h;
   }
@@ -157,14 +195,11 @@ class MH1 {
     h.overflow  = this->overflow - rhs.overflow;
     h.nanflow   = this->nanflow - rhs.nanflow;
 
-    // DATA
-    h.weights  = this->weights;
-    h.weights2 = this->weights2;
-    h.counts   = this->counts;
-    for (std::size_t i = 0; i < h.weights.size(); ++i) {
-      h.weights[i] -= rhs.weights[i];
-      h.weights2[i] -= rhs.weights2[i];
-      h.counts[i] -= rhs.counts[i];
+    // DATA (single fused pass)
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+      h.weights[i]  = weights[i] - rhs.weights[i];
+      h.weights2[i] = weights2[i] - rhs.weights2[i];
+      h.counts[i]   = counts[i] - rhs.counts[i];
     }
     return h;
   }
@@ -183,14 +218,11 @@ class MH1 {
     h.overflow  = this->overflow;
     h.nanflow   = this->nanflow;
 
-    // DATA
-    h.weights  = this->weights;
-    h.weights2 = this->weights2;
-    h.counts   = this->counts;
-    for (std::size_t i = 0; i < h.weights.size(); ++i) {
-      h.weights[i] *= rhs.weights[i];
-      h.weights2[i] *= rhs.weights2[i];
-      h.counts[i] *= rhs.counts[i];
+    // DATA (single fused pass)
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+      h.weights[i]  = weights[i] * rhs.weights[i];
+      h.weights2[i] = weights2[i] * rhs.weights2[i];
+      h.counts[i]   = counts[i] * rhs.counts[i];
     }
     return h;
   }
@@ -209,14 +241,11 @@ class MH1 {
     h.overflow  = this->overflow;
     h.nanflow   = this->nanflow;
 
-    // DATA
-    h.weights  = this->weights;
-    h.weights2 = this->weights2;
-    h.counts   = this->counts;
-    for (std::size_t i = 0; i < h.weights.size(); ++i) {
-      h.weights[i]  = (std::abs(rhs.weights[i]) > 0) ? h.weights[i] / rhs.weights[i] : 0;
-      h.weights2[i] = (std::abs(rhs.weights2[i]) > 0) ? h.weights2[i] / rhs.weights2[i] : 0;
-      h.counts[i]   = (rhs.counts[i] > 0) ? h.counts[i] / rhs.counts[i] : 0;
+    // DATA (single fused pass)
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+      h.weights[i]  = (std::abs(rhs.weights[i]) > 0) ? weights[i] / rhs.weights[i] : 0;
+      h.weights2[i] = (std::abs(rhs.weights2[i]) > 0) ? weights2[i] / rhs.weights2[i] : 0;
+      h.counts[i]   = (rhs.counts[i] > 0) ? counts[i] / rhs.counts[i] : 0;
     }
     return h;
   }
@@ -289,6 +318,26 @@ class MH1 {
   // Used for non-uniform width binning, otherwise can be empty
   std::vector<std::vector<double>> binedges;
 
+  // Flat (XBINS+1) edge array mirror of binedges for cache-friendly binary
+  // search; usable when the bins are contiguous (no holes)
+  std::vector<double> edges_flat_;
+  bool                edges_contiguous_ = false;
+
+  // Cached reciprocal binning constants (set in ResetBounds), so the
+  // per-fill index computation is a multiply instead of a divide
+  double inv_dx_       = 0.0;
+  double log10_xmin_   = 0.0;
+  double inv_log10_dx_ = 0.0;
+
+  // Cached uniform-bin geometry (lower, center, upper per bin), so
+  // GetBinXVal does no log10/pow per call in the LOGX case; rebuilt by
+  // ResetBounds and SetLogX
+  std::vector<double> bin_lo_;
+  std::vector<double> bin_center_;
+  std::vector<double> bin_hi_;
+
+  void BuildBinCache();
+
   // Boundary conditions
   double XMIN  = 0.0;
   double XMAX  = 0.0;
@@ -301,9 +350,9 @@ class MH1 {
   long long int nanflow   = 0;
 
   // weights (in unweighted case weights = counts)
-  std::vector<T>             weights;
-  std::vector<T>             weights2;
-  std::vector<long long int> counts;  // counts
+  std::vector<T>       weights;
+  std::vector<T>       weights2;
+  std::vector<count_t> counts;  // counts
 
   // Logarithmic binning
   bool LOGX = false;
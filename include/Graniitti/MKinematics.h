@@ -8,6 +8,7 @@
 
 
 // C++
+#include <array>
 #include <complex>
 #include <random>
 #include <valarray>
@@ -30,10 +31,10 @@ namespace gra {
 namespace kinematics {
 
 // Case m3 = m4
-inline double SolvePz3_A(double m3, double pt3, double pt4, double pz5, double E5, double s) {
+inline double SolvePz3_A(double m3, double pt3_2, double pt4_2, double pz5, double E5, double s) {
   const double t2  = E5 * E5;
-  const double t3  = pt3 * pt3;
-  const double t4  = pt4 * pt4;
+  const double t3  = pt3_2;
+  const double t4  = pt4_2;
   const double t5  = pz5 * pz5;
   const double t6  = m3 * m3;
   const double t7  = std::sqrt(s);
@@ -114,13 +115,13 @@ s) {
 */
 
 // Case m3, m4 same or different
-inline double SolvePz3_B(double m3, double m4, double pt3, double pt4, double pz5, double E5,
+inline double SolvePz3_B(double m3, double m4, double pt3_2, double pt4_2, double pz5, double E5,
                          double s) {
   const double t2  = E5 * E5;
   const double t3  = m3 * m3;
   const double t4  = m4 * m4;
-  const double t5  = pt3 * pt3;
-  const double t6  = pt4 * pt4;
+  const double t5  = pt3_2;
+  const double t6  = pt4_2;
   const double t7  = pz5 * pz5;
   const double t8  = std::sqrt(s);
   const double t9  = s * t2 * 6.0;
@@ -222,9 +223,23 @@ inline double SolvePz(double m3, double m4, double pt3, double pt4, double pz5,
   constexpr double EPS = 1e-9;
 
   if (std::abs(m3 - m4) < EPS) {  // identical mass case (elastic-X-elastic)
-    return SolvePz3_A(m3, pt3, pt4, pz5, E5, s);
+    return SolvePz3_A(m3, pt3 * pt3, pt4 * pt4, pz5, E5, s);
   } else {
-    return SolvePz3_B(m3, m4, pt3, pt4, pz5, E5, s);
+    return SolvePz3_B(m3, m4, pt3 * pt3, pt4 * pt4, pz5, E5, s);
+  }
+}
+
+// As SolvePz but with the transverse momenta given squared; both
+// polynomial branches only use pt^2, so callers holding Pt2() skip the
+// sqrt round-trip
+inline double SolvePz2(double m3, double m4, double pt3_2, double pt4_2, double pz5, double E5,
+                       double s) {
+  constexpr double EPS = 1e-9;
+
+  if (std::abs(m3 - m4) < EPS) {  // identical mass case (elastic-X-elastic)
+    return SolvePz3_A(m3, pt3_2, pt4_2, pz5, E5, s);
+  } else {
+    return SolvePz3_B(m3, m4, pt3_2, pt4_2, pz5, E5, s);
   }
 }
 
@@ -400,6 +415,27 @@ inline void LorentzBoost(const T &boost, double M0, T &p, int sign) {
   p = T(p3[0], p3[1], p3[2], gamma * (p.E() + kappa1));
 }
 
+// Boost a contiguous batch of N 4-vectors with the frame factors (beta,
+// gamma) of "boost" computed once; calling LorentzBoost per vector
+// recomputes them every time and round-trips through valarray temporaries.
+// Same arithmetic as LorentzBoost up to the summation order of the inner
+// product (agreement to the last ulp).
+template <typename T>
+inline void LorentzBoostBatch(const T &boost, double M0, T *p, std::size_t N, int sign) {
+  // Mother beta-vector and gamma-factor
+  const double bx    = sign * boost.Px() / boost.E();
+  const double by    = sign * boost.Py() / boost.E();
+  const double bz    = sign * boost.Pz() / boost.E();
+  const double gamma = boost.E() / M0;
+
+  for (std::size_t i = 0; i < N; ++i) {
+    const double kappa1 = bx * p[i].Px() + by * p[i].Py() + bz * p[i].Pz();
+    const double kappa2 = gamma * (gamma * kappa1 / (1.0 + gamma) + p[i].E());
+    p[i] = T(p[i].Px() + kappa2 * bx, p[i].Py() + kappa2 * by, p[i].Pz() + kappa2 * bz,
+             gamma * (p[i].E() + kappa1));
+  }
+}
+
 // Flat variables in spherical coordinates
 template <typename T2>
 inline void FlatIsotropic(double &costheta, double &sintheta, double &phi, T2 &rng) {
@@ -1685,10 +1721,18 @@ class LORENTZSCALAR {
   gra::MParticle beam2;
 
   // Four momenta of initial and final states
-  M4Vec              pbeam1;
-  M4Vec              pbeam2;
-  std::vector<M4Vec> pfinal;
-  std::vector<M4Vec> pfinal_orig;
+  //
+  // Final states live in fixed inline storage (final state count is
+  // bounded for all processes); M4Vec() zero-initializes each slot.
+  // pfinal_n is the number of active slots [0 = central system,
+  // 1,2 = forward legs, 3... = central final states]
+  // (32-byte alignment puts each 4-double M4Vec on its own vector lane)
+  static constexpr std::size_t          PFINAL_MAX = 16;
+  M4Vec                                 pbeam1;
+  M4Vec                                 pbeam2;
+  alignas(32) std::array<M4Vec, PFINAL_MAX> pfinal;
+  alignas(32) std::array<M4Vec, PFINAL_MAX> pfinal_orig;
+  unsigned int                          pfinal_n = 0;
 
   // Basic Lorentz scalars
   double s      = 0.0;
@@ -234,6 +234,39 @@ inline MMatrix<T> TensorProd(const MMatrix<T> &A, const MMatrix<T> &B) {
   return C;
 }
 
+// Fused Kronecker product times matrix: (A(x)B) * X = C
+//
+// Avoids materializing the (rowA*rowB) x (colA*colB) Kronecker matrix;
+// the accumulation order matches TensorProd(A,B) * X exactly
+//
+template <typename T>
+inline MMatrix<T> KronMul(const MMatrix<T> &A, const MMatrix<T> &B, const MMatrix<T> &X) {
+  const unsigned int rowA = A.size_row();
+  const unsigned int rowB = B.size_row();
+  const unsigned int colA = A.size_col();
+  const unsigned int colB = B.size_col();
+
+  if (X.size_row() != colA * colB) {
+    throw std::invalid_argument("MMatOper::KronMul: (A(x)B) * X with invalid dimension on X");
+  }
+  const unsigned int p = X.size_col();
+
+  MMatrix<T> C(rowA * rowB, p, 0.0);  // Note initialization to 0.0!
+
+  for (std::size_t i = 0; i < rowA; ++i) {
+    for (std::size_t k = 0; k < rowB; ++k) {
+      for (std::size_t j = 0; j < p; ++j) {
+        for (std::size_t a = 0; a < colA; ++a) {
+          for (std::size_t b = 0; b < colB; ++b) {
+            C[i * rowB + k][j] += A[i][a] * B[k][b] * X[a * colB + b][j];
+          }
+        }
+      }
+    }
+  }
+  return C;
+}
+
 // Print out vector elements
 template <typename T>
 inline void PrintVector(const std::vector<T> &A, const std::string name = "") {
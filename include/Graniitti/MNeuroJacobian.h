@@ -51,8 +51,8 @@ bool         FLAT_TARGET = false;
 
 // declare a pointer to member function
 MProcess *procptr;
-double (MProcess::*ptfptr)(const std::vector<double> &randvec,
-                           AuxIntData &               aux) = &MProcess::EventWeight;
+double (MProcess::*ptfptr)(std::span<const double> randvec,
+                           AuxIntData &            aux) = &MProcess::EventWeight;
 
 // Function to be integrated
 double func(std::vector<double> &x) {
@@ -9,6 +9,7 @@
 // C++
 #include <complex>
 #include <random>
+#include <span>
 #include <vector>
 
 // Own
@@ -30,10 +31,10 @@ class MParton : public MProcess {
 
   void post_Constructor();
 
-  double operator()(const std::vector<double> &randvec, AuxIntData &aux) {
+  double operator()(std::span<const double> randvec, AuxIntData &aux) {
     return EventWeight(randvec, aux);
   }
-  double EventWeight(const std::vector<double> &randvec, AuxIntData &aux);
+  double EventWeight(std::span<const double> randvec, AuxIntData &aux);
   bool   EventRecord(HepMC3::GenEvent &evt);
   void   PrintInit(bool silent) const;
 
@@ -43,7 +44,7 @@ class MParton : public MProcess {
   bool FiducialCuts() const;
 
   // 2->2 dim phase space
-  bool B2RandomKin(const std::vector<double> &randvec);
+  bool B2RandomKin(std::span<const double> randvec);
   bool B2BuildKin(double xbj1, double xbj2);
   void B2RecordEvent(HepMC3::GenEvent &evt);
 
@@ -9,6 +9,7 @@
 // C++
 #include <complex>
 #include <random>
+#include <span>
 #include <vector>
 
 // HepMC33
@@ -80,8 +81,10 @@ class MProcess : public MUserHistograms {
   virtual void post_Constructor()           = 0;
   virtual void PrintInit(bool silent) const = 0;
 
-  virtual double operator()(const std::vector<double> &randvec, AuxIntData &aux)  = 0;
-  virtual double EventWeight(const std::vector<double> &randvec, AuxIntData &aux) = 0;
+  // Random numbers come in as a non-owning view, so integrators may hand
+  // over any contiguous buffer without constructing a std::vector per call
+  virtual double operator()(std::span<const double> randvec, AuxIntData &aux)  = 0;
+  virtual double EventWeight(std::span<const double> randvec, AuxIntData &aux) = 0;
   virtual bool   EventRecord(HepMC3::GenEvent &evt)                               = 0;
 
   // Set central system decay structure
@@ -294,9 +297,12 @@ class MProcess : public MUserHistograms {
   double ForwardVolume() const;
 
   // Lorentz scalars
-  bool GetLorentzScalars(unsigned int Nf);
+  // central_fixed = true skips the invariants among the central decay
+  // products (valid in the screening kT loop when only the forward legs
+  // and the central system sum are moved)
+  bool GetLorentzScalars(unsigned int Nf, bool central_fixed = false);
 
-  void SampleForwardMasses(std::vector<double> &mvec, const std::vector<double> &randvec);
+  void SampleForwardMasses(std::vector<double> &mvec, std::span<const double> randvec);
 
   // --------------------------------------------------------
   // System fragmentation
@@ -53,8 +53,11 @@ inline double alpha_QED(double Q2, const std::string& order = "LL") {
   }
 }
 
-// QED coupling at Q = 0
-inline double alpha_QED() { return alpha_QED(0, "ZERO"); }
+// QED coupling at Q = 0 (frozen coupling). Returns the constant directly:
+// going through alpha_QED(0, "ZERO") would construct and compare a
+// temporary std::string on every call, and the flux functions call this
+// once per phase-space sample
+inline double alpha_QED() { return alpha_0; }
 
 // QED: Electric charge in natural units ~ 0.3
 inline double e_QED(double Q2) { return math::msqrt(alpha_QED(Q2) * 4.0 * math::PI); }
@@ -9,6 +9,7 @@
 // C++
 #include <complex>
 #include <random>
+#include <span>
 #include <vector>
 
 // HepMC33
@@ -31,10 +32,10 @@ class MQuasiElastic : public MProcess {
 
   void post_Constructor();
 
-  double operator()(const std::vector<double> &randvec, AuxIntData &aux) {
+  double operator()(std::span<const double> randvec, AuxIntData &aux) {
     return EventWeight(randvec, aux);
   }
-  double EventWeight(const std::vector<double> &randvec, AuxIntData &aux);
+  double EventWeight(std::span<const double> randvec, AuxIntData &aux);
   bool   EventRecord(HepMC3::GenEvent &evt);
   void   PrintInit(bool silent) const;
 
@@ -44,10 +45,10 @@ class MQuasiElastic : public MProcess {
   bool FiducialCuts() const;
 
   // Non-Diffractive
-  std::complex<double> PolySoft(const std::vector<double> &randvec);
+  std::complex<double> PolySoft(std::span<const double> randvec);
 
   // 2/3-Dim phase space, 2->2 quasielastic
-  bool   B3RandomKin(const std::vector<double> &randvec);
+  bool   B3RandomKin(std::span<const double> randvec);
   bool   B3BuildKin(double s3, double s4, double t);
   bool   B3GetLorentzScalars();
   double B3IntegralVolume() const;
@@ -7,11 +7,109 @@
 #define MRANDOM_H
 
 // C++
+#include <array>
 #include <complex>
+#include <cstdint>
 #include <random>
 #include <vector>
 
 namespace gra {
+
+// Philox4x64-10 counter-based random number engine
+// [REFERENCE: Salmon, Moraes, Dror, Shaw, https://doi.org/10.1145/2063384.2063405]
+//
+// Counter-based: the state is a trivially incremented 256-bit counter plus
+// a 128-bit key, so generation is branch-light integer multiply/xor work
+// (no carry chains as in RANLUX) and streams are cheap to split by key.
+// Satisfies the C++ UniformRandomBitGenerator requirements, so it plugs
+// into std::uniform_real_distribution, std::shuffle etc. as a drop-in.
+class MPhilox4x64 {
+ public:
+  using result_type = uint64_t;
+
+  MPhilox4x64() { seed(); }
+  explicit MPhilox4x64(uint64_t s) { seed(s); }
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return UINT64_MAX; }
+
+  // Default initialization
+  void seed() { seed(0x1BD11BDAA9FC1A22ULL); }
+
+  void seed(uint64_t s) {
+    key = {s, 0x9E3779B97F4A7C15ULL};  // Golden ratio as the second word
+    ctr = {0, 0, 0, 0};
+    pos = 4;  // Force new block on next call
+  }
+
+  // Select an independent stream of the current seed (e.g. one per
+  // thread). The stream id goes into the second key word, so any two ids
+  // give disjoint output sequences by construction -- no overlap risk as
+  // with arithmetic seed offsets. Call after seed(); restarts the counter.
+  void set_stream(uint64_t sid) {
+    key[1] = 0x9E3779B97F4A7C15ULL ^ sid;
+    ctr    = {0, 0, 0, 0};
+    pos    = 4;
+  }
+
+  void seed(std::seed_seq &seq) {
+    std::array<uint32_t, 4> tmp = {};
+    seq.generate(tmp.begin(), tmp.end());
+    seed((static_cast<uint64_t>(tmp[0]) << 32) ^ (static_cast<uint64_t>(tmp[1]) << 16) ^
+         (static_cast<uint64_t>(tmp[2]) << 8) ^ static_cast<uint64_t>(tmp[3]));
+  }
+
+  result_type operator()() {
+    if (pos == 4) {
+      NextBlock();
+      pos = 0;
+    }
+    return out[pos++];
+  }
+
+ private:
+  // 64x64 -> 128 bit product split into high and low words
+  static void mulhilo(uint64_t a, uint64_t b, uint64_t &hi, uint64_t &lo) {
+    const unsigned __int128 prod = static_cast<unsigned __int128>(a) * b;
+    hi                           = static_cast<uint64_t>(prod >> 64);
+    lo                           = static_cast<uint64_t>(prod);
+  }
+
+  void NextBlock() {
+    // Round multipliers and Weyl key increments from the reference
+    // implementation (Random123)
+    constexpr uint64_t M0 = 0xD2E7470EE14C6C93ULL;
+    constexpr uint64_t M1 = 0xCA5A826395121157ULL;
+    constexpr uint64_t W0 = 0x9E3779B97F4A7C15ULL;
+    constexpr uint64_t W1 = 0xBB67AE8584CAA73BULL;
+
+    std::array<uint64_t, 4> x = ctr;
+    std::array<uint64_t, 2> k = key;
+
+    for (std::size_t round = 0; round < 10; ++round) {
+      uint64_t hi0 = 0, lo0 = 0, hi1 = 0, lo1 = 0;
+      mulhilo(M0, x[0], hi0, lo0);
+      mulhilo(M1, x[2], hi1, lo1);
+      x = {hi1 ^ x[1] ^ k[0], lo1, hi0 ^ x[3] ^ k[1], lo0};
+      k[0] += W0;
+      k[1] += W1;
+    }
+    out = x;
+
+    // Increment the 256-bit counter
+    if (++ctr[0] == 0) {
+      if (++ctr[1] == 0) {
+        if (++ctr[2] == 0) { ++ctr[3]; }
+      }
+    }
+  }
+
+  std::array<uint64_t, 4> ctr = {0, 0, 0, 0};
+  std::array<uint64_t, 2> key = {0, 0};
+  std::array<uint64_t, 4> out = {0, 0, 0, 0};
+  std::size_t             pos = 4;
+};
+
 class MRandom {
  public:
   // Calling constructors of member functions
@@ -41,6 +139,10 @@ class MRandom {
   }
 
 
+  // Select an independent sub-stream of the current seed (one per
+  // thread); the counter-based engine guarantees disjoint sequences
+  void SetStream(uint64_t sid) { rng.set_stream(sid); }
+
   // Return current random seed
   uint32_t GetSeed() const { return RNDSEED; }
 
@@ -68,11 +170,14 @@ class MRandom {
 
   // 48-bit RANLUX (a bit slower)
   // [REFERENCE: Luscher, https://arxiv.org/abs/hep-lat/9309020]
-  std::ranlux48 rng;
+  // std::ranlux48 rng;
+
+  // Philox 4x64-10 counter-based generator (faster, trivial stream splitting)
+  MPhilox4x64 rng;
 
-  std::ranlux48 get_generator() {
+  MPhilox4x64 get_generator() {
     return rng;
-  }  
+  }
   
   // Distribution engines
   std::uniform_real_distribution<double> flat;
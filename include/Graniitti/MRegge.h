@@ -7,6 +7,7 @@
 #define MREGGE_H
 
 // C++
+#include <array>
 #include <complex>
 #include <random>
 #include <vector>
@@ -30,6 +31,7 @@ extern std::vector<double> sgn;
 extern double s0;
 
 extern std::string offshellFF;
+extern int         offshellFF_mode;  // offshellFF resolved to an integer (-1 = unresolved)
 extern double      b_EXP;
 extern double      a_OREAR;
 extern double      b_OREAR;
@@ -41,7 +43,8 @@ extern int    ampcombs;
 
 // Meson/Baryon Couplings and Pomeron, Reggeon, Reggeon exchanges
 extern std::vector<double> c;       // coupling
-extern std::vector<bool>   active;  // on/off
+extern std::vector<bool>   active;      // on/off
+extern std::vector<int>    active_idx;  // indices of the active exchanges
 
 void PrintParam();
 void ReadParameters(int PDG, const std::string &modelfile);
@@ -54,6 +57,8 @@ double Proton_FF(double tprime, double b);
 double Meson_FF(double that, double M2);
 double Baryon_FF(double that, double M2);
 double ResonanceFormFactor(double shat, double M2, double S0);
+// N.B. not pure: updates the form factor cache on the resonance
+double ResonanceFormFactor(double shat, const gra::PARAM_RES &resonance);
 
 // Propagators
 double               Meson_prop(double that, double M2);
@@ -76,15 +81,16 @@ class MRegge {
   std::complex<double> ME3ODD(gra::LORENTZSCALAR &lts, gra::PARAM_RES &resonance) const;
 
   std::complex<double> ME3HEL(gra::LORENTZSCALAR &lts, gra::PARAM_RES &resonance) const;
+  double               ME3HEL2(gra::LORENTZSCALAR &lts, gra::PARAM_RES &resonance) const;
   std::complex<double> PhotoME3(gra::LORENTZSCALAR &lts, gra::PARAM_RES &resonance) const;
 
   void PomPomProtonVertex(const gra::LORENTZSCALAR &lts, double &FF_A, double &FF_B) const;
 
-  // Constructor amplitude leg permutations
-  void ConstructPerm(int type);
-
   // Regge propagators
   std::complex<double> PropOnly(double s, double t, int k = 0) const;
+  void                 PropOnlyBatch(const double *s, std::size_t n, double t, int k, double *re,
+                                     double *im) const;
+  std::complex<double> SignatureEta(double t, int k, double sign = 1.0) const;
   std::complex<double> OdderonProp(double s, double t) const;
   std::complex<double> PhotoProp(double s, double t, double m2, bool excite,
                                  double M2_forward) const;
@@ -97,9 +103,33 @@ class MRegge {
   int                  xi3(int J, int P, int P_i, int sigma_i, int P_k, int sigma_k) const;
 
  private:
-  // Amplitude permutations, these need to be initialized within calling amplitude function
-  std::vector<std::vector<int>> permutations4;
-  std::vector<std::vector<int>> permutations6;
+  // Cached t-independent signature prefactors eta(alpha(0), sigma) per
+  // trajectory, for both signature signs (PARAM_REGGE trajectory
+  // parameters are fixed after initialization). Filled lazily by
+  // SignatureEta.
+  mutable std::vector<std::complex<double>> eta0_cache_;
+  mutable std::vector<std::complex<double>> eta0_flip_cache_;
+
+  // ME3HEL helicity enumeration: 16(2J+1) rows of doubled (half-)integer
+  // helicities {2*lambda1, 2*lambda2, 2*lambda3, 2*lambda4, 2*lambda_h},
+  // rebuilt only when the resonance spin J changes
+  mutable std::vector<std::array<int8_t, 5>> hel_lambda_;
+  mutable int                                hel_lambda_J_ = -1;
+
+  // PomPomProtonVertex memoization: the vertex factors depend only on the
+  // inputs below, which repeat when several sub-amplitudes (resonances,
+  // exchanges) are evaluated for one event kinematics
+  mutable bool   pppv_valid_ = false;
+  mutable bool   pppv_ex1_ = false, pppv_ex2_ = false;
+  mutable double pppv_t1_ = 0.0, pppv_t2_ = 0.0;
+  mutable double pppv_m1sq_ = 0.0, pppv_m2sq_ = 0.0;
+  mutable double pppv_gN_ = 0.0, pppv_g3P_ = 0.0;
+  mutable double pppv_FFA_ = 0.0, pppv_FFB_ = 0.0;
+
+  // PhotoProp running-slope cache: B0 depends only on the vector meson
+  // mass^2, which is fixed per process
+  mutable double photoB0_m2_ = -1.0;
+  mutable double photoB0_    = 0.0;
 };
 
 }  // namespace gra
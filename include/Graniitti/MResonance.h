@@ -97,6 +97,20 @@ class PARAM_RES {
   // Helicity and decay amplitude information
   HELMatrix hel;
   // --------------------------------------------------------------------
+
+  // CBW_BF evaluation cache: the barrier factor denominator depends only
+  // on (M0, mA, mB), which is fixed across events for zero-width
+  // daughters; recomputed when the daughter masses change
+  mutable double bw_mA = -1.0;
+  mutable double bw_mB = -1.0;
+  mutable double bw_d  = 0.0;
+
+  // ResonanceFormFactor evaluation cache: M^2 and 1/S0^4 are refreshed
+  // when the (possibly re-tuned) pole mass or form factor parameter change
+  mutable double ff_mass    = -1.0;
+  mutable double ff_S0      = -1.0;
+  mutable double ff_M2      = 0.0;
+  mutable double ff_inv_S04 = 0.0;
 };
 
 }  // namespace gra
@@ -8,6 +8,7 @@
 
 // C++
 #include <complex>
+#include <cstdint>
 #include <iostream>
 #include <vector>
 
@@ -64,6 +65,47 @@ struct Omega {
   bool selected = false;
 };
 
+// Structure-of-Arrays mirror of an Omega event stream
+//
+// Each analysis kernel touches only a subset of the Omega fields per pass
+// (YLM reads costheta/phi, the hyperbin selection reads M/Pt/Y), so the
+// per-field arrays keep those sweeps contiguous instead of striding over
+// whole Omega records.
+struct OmegaSoA {
+  std::vector<double>  costheta;
+  std::vector<double>  phi;
+  std::vector<double>  M;
+  std::vector<double>  Pt;
+  std::vector<double>  Y;
+  std::vector<uint8_t> fiducial;
+  std::vector<uint8_t> selected;
+
+  std::size_t size() const { return costheta.size(); }
+
+  // One-time conversion per analysis batch
+  static OmegaSoA FromAoS(const std::vector<Omega> &events) {
+    OmegaSoA out;
+    const std::size_t N = events.size();
+    out.costheta.resize(N);
+    out.phi.resize(N);
+    out.M.resize(N);
+    out.Pt.resize(N);
+    out.Y.resize(N);
+    out.fiducial.resize(N);
+    out.selected.resize(N);
+    for (std::size_t i = 0; i < N; ++i) {
+      out.costheta[i] = events[i].costheta;
+      out.phi[i]      = events[i].phi;
+      out.M[i]        = events[i].M;
+      out.Pt[i]       = events[i].Pt;
+      out.Y[i]        = events[i].Y;
+      out.fiducial[i] = events[i].fiducial;
+      out.selected[i] = events[i].selected;
+    }
+    return out;
+  }
+};
+
 // Container
 struct Data {
   // Metadata
@@ -116,8 +158,15 @@ void PrintOutMoments(const std::vector<double> &x, const std::vector<double> &x_
 std::vector<std::size_t> GetIndices(const std::vector<Omega> &events, const std::vector<double> &M,
                                     const std::vector<double> &Pt, const std::vector<double> &Y);
 
-void   TestSphericalIntegrals(int LMAX);
-int    LinearInd(int l, int m);
+std::vector<std::size_t> GetIndices(const OmegaSoA &events, const std::vector<double> &M,
+                                    const std::vector<double> &Pt, const std::vector<double> &Y);
+
+void TestSphericalIntegrals(int LMAX);
+
+// Linear index of (l,m): closed form, inline so the hot expansion loops
+// see straight index arithmetic instead of an out-of-line call
+inline int LinearInd(int l, int m) { return l * (l + 1) + m; }
+
 double CalcError(double f2, double f, double N);
 void   PrintMatrix(FILE *fp, const std::vector<std::vector<double>> &A);
 
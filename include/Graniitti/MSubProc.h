@@ -7,8 +7,12 @@
 #define MSUBPROC_H
 
 // C++
+#include <algorithm>
 #include <complex>
 #include <random>
+#include <type_traits>
+#include <utility>
+#include <variant>
 #include <vector>
 
 // Own
@@ -36,7 +40,8 @@ std::unique_ptr<T> copy_unique(const std::unique_ptr<T>& source) {
 }
 
 
-// Abstract process base class
+// Process base class (non-virtual, concrete processes are dispatched
+// through std::variant below)
 //
 // BASIC DESIGN:
 // Use "late (lazy) construction", that is, objects are pointers and initialized only
@@ -55,12 +60,35 @@ class MProc {
   std::vector<std::string> DESCRIPTION;
 
   // ---------------------------------------------------------------------
-  // Default copy, assignment and move work fine
-
-  // MProc(MProc const&) = default;
+  // Copy and assignment deep-copy the lazily constructed amplitude
+  // containers, so each process copy (e.g. per thread) owns its own
+
+  // N.B. The resonance partition cache is deliberately NOT copied: it holds
+  // pointers into the source object's lts.RESONANCES map and is rebuilt
+  // lazily by the copy against its own kinematics container
+  MProc(const MProc& other)
+      : ISTATE(other.ISTATE),
+        CHANNEL(other.CHANNEL),
+        DESCRIPTION(other.DESCRIPTION),
+        Gamma(copy_unique(other.Gamma)),
+        Durham(copy_unique(other.Durham)),
+        Regge(copy_unique(other.Regge)),
+        Tensor(copy_unique(other.Tensor)) {}
   MProc(MProc&&) = default;
 
-  // MProc& operator=(MProc const&) = default;
+  MProc& operator=(const MProc& other) {
+    ISTATE      = other.ISTATE;
+    CHANNEL     = other.CHANNEL;
+    DESCRIPTION = other.DESCRIPTION;
+    Gamma       = copy_unique(other.Gamma);
+    Durham      = copy_unique(other.Durham);
+    Regge       = copy_unique(other.Regge);
+    Tensor      = copy_unique(other.Tensor);
+    reso_vector_odd.clear();
+    reso_other.clear();
+    reso_partitioned = false;
+    return *this;
+  }
   MProc& operator=(MProc&&) = default;
   // ---------------------------------------------------------------------
 
@@ -85,31 +113,65 @@ class MProc {
     if (Regge == nullptr) { Regge = make_unique<MRegge>(lts, GetModelFile()); }
   }
 
-  // ---------------------------------------------------------------------
+  // Resonances partitioned once by the static (J odd, P = -1) property,
+  // so the per-event resonance loops need no branch per entry
+  std::vector<gra::PARAM_RES*> reso_vector_odd;
+  std::vector<gra::PARAM_RES*> reso_other;
+  bool                         reso_partitioned = false;
 
-  virtual ~MProc() {}  // Needs to be virtual
+  void PartitionResonances(gra::LORENTZSCALAR& lts) {
+    if (reso_partitioned) { return; }
+    for (auto& x : lts.RESONANCES) {
+      const int J = static_cast<int>(x.second.p.spinX2 / 2.0);
+      if ((J % 2 != 0) && x.second.p.P == -1) {
+        reso_vector_odd.push_back(&x.second);
+      } else {
+        reso_other.push_back(&x.second);
+      }
+    }
+    reso_partitioned = true;
+  }
 
-  virtual double Amp2(gra::LORENTZSCALAR& lts) = 0;
+  // Coherent resonance sum over the pre-partitioned lists
+  std::complex<double> ResonanceSum(gra::LORENTZSCALAR& lts) {
+    PartitionResonances(lts);
+    std::complex<double> A = 0.0;
+    // Gamma-Pomeron for vectors
+    for (auto* x : reso_vector_odd) { A += Regge->PhotoME3(lts, *x); }
+    // Pomeron-Pomeron, J = 0,1,2,... all ok
+    for (auto* x : reso_other) { A += Regge->ME3(lts, *x); }
+    return A;
+  }
+
+  // ---------------------------------------------------------------------
+
+  ~MProc() {}
 
   // Processes usable with different fluxes
   // 2y ->
   double GammaGammaCON(gra::LORENTZSCALAR& lts) {
-    double amp2 = 0.0;
-    if (!AssertN(2, lts.decaytree.size())) {
-      throw std::invalid_argument(ISTATE + "[" + CHANNEL + "] requires 2-body final state");
-    }
-
-    if (AssertN({24, -24}, PDGlist(lts))) {
-      amp2 = Gamma->AmpMG5_yy_ww.CalcAmp2(lts, 0.0);
-    } else if (AssertLeptonQuarkMonopolePair(PDGlist(lts))) {
-      amp2 = Gamma->yyffbar(lts);
-    } else {
-      ThrowUnknownFinalState();
+    // Resolve the final state branch once (it is fixed within a run)
+    if (yy_mode == 0) {
+      if (!AssertN(2, lts.decaytree.size())) {
+        throw std::invalid_argument(ISTATE + "[" + CHANNEL + "] requires 2-body final state");
+      }
+      const std::vector<int> pdglist = PDGlist(lts);
+
+      if (AssertN({24, -24}, pdglist)) {
+        yy_mode = 1;
+      } else if (AssertLeptonQuarkMonopolePair(pdglist)) {
+        yy_mode = 2;
+      } else {
+        ThrowUnknownFinalState();
+      }
     }
-
-    return amp2;
+    return (yy_mode == 1) ? Gamma->AmpMG5_yy_ww.CalcAmp2(lts, 0.0) : Gamma->yyffbar(lts);
   }
 
+  // GammaGammaCON final state resolved to an integer (0 = unresolved,
+  // 1 = W+W-, 2 = f fbar)
+  int yy_mode = 0;
+
   // Return general modelfile
   std::string GetModelFile() const {
     return gra::aux::GetBasePath(2) + "/modeldata/" + gra::MODELPARAM + "/GENERAL.json";
@@ -125,14 +187,11 @@ class MProc {
 
   // Assert lepton or quark pair
   bool AssertLeptonQuarkMonopolePair(const std::vector<int>& input) const {
-    // PDG identifiers
-    static const MMatrix<int> X = {{11, -11}, {13, -13}, {15, -15}, {1, -1}, {2, -2},
-                                   {3, -3},   {4, -4},   {5, -5},   {6, -6}, {992, -992}};
-
-    for (std::size_t i = 0; i < X.size_row(); ++i) {
-      if (AssertN({X[i][0], X[i][1]}, input)) { return true; }
-    }
-    return false;
+    // Every allowed pair is a particle-antiparticle pair {x, -x}, so test
+    // directly against the lepton / quark / monopole PDG identifiers
+    if (input.size() != 2 || input[0] != -input[1]) { return false; }
+    const int a = std::abs(input[0]);
+    return a == 11 || a == 13 || a == 15 || (a >= 1 && a <= 6) || a == 992;
   }
 
   // Get PDG list
@@ -156,7 +215,7 @@ class PROC_0 : public MProc {
  public:
   PROC_0() : MProc("yy", "RES", {"Parametric resonance", "kt-EPA"}) {}
   ~PROC_0() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitGamma(lts);
     const double amp2 = Gamma->yyX(lts, lts.RESONANCES.begin()->second);
     return flux::ApplyktEPAfluxes(amp2, lts);
@@ -166,7 +225,7 @@ class PROC_1 : public MProc {
  public:
   PROC_1() : MProc("yy", "Higgs", {"SM Higgs", "kt-EPA"}) {}
   ~PROC_1() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitGamma(lts);
     const double amp2 = Gamma->yyHiggs(lts);
     return flux::ApplyktEPAfluxes(amp2, lts);
@@ -176,7 +235,7 @@ class PROC_2 : public MProc {
  public:
   PROC_2() : MProc("yy", "monopolium(0)", {"Monopolium (J=0)", "kt-EPA"}) {}
   ~PROC_2() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitGamma(lts);
     const double amp2 = Gamma->yyMP(lts);
     return flux::ApplyktEPAfluxes(amp2, lts);
@@ -186,7 +245,7 @@ class PROC_3 : public MProc {
  public:
   PROC_3() : MProc("yy", "CON", {"Continuum l+l-, qqbar, W+W-, monopolepair", "kt-EPA"}) {}
   ~PROC_3() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitGamma(lts);
     double amp2 = GammaGammaCON(lts);
     return flux::ApplyktEPAfluxes(amp2, lts);
@@ -196,7 +255,7 @@ class PROC_4 : public MProc {
  public:
   PROC_4() : MProc("yy", "QED", {"Continuum l+l-, qqbar", "FULL QED"}) {}
   ~PROC_4() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitTensor(lts);
 
     if (!AssertN(2, lts.decaytree.size())) {
@@ -215,7 +274,7 @@ class PROC_5 : public MProc {
  public:
   PROC_5() : MProc("X", "EL", {"Elastic", "Eikonal Pomeron", "Use with screening loop on"}) {}
   ~PROC_5() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitRegge(lts);
     return abs2(Regge->ME2(lts, 1));
   }
@@ -224,7 +283,7 @@ class PROC_6 : public MProc {
  public:
   PROC_6() : MProc("X", "SD", {"Single Diffractive", "Triple Pomeron", "With TOY fragmentation"}) {}
   ~PROC_6() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitRegge(lts);
     return abs2(Regge->ME2(lts, 2));
   }
@@ -233,7 +292,7 @@ class PROC_7 : public MProc {
  public:
   PROC_7() : MProc("X", "DD", {"Double Diffractive", "Triple Pomeron", "With TOY fragmentation"}) {}
   ~PROC_7() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitRegge(lts);
     return abs2(Regge->ME2(lts, 3));
   }
@@ -243,7 +302,7 @@ class PROC_8 : public MProc {
   PROC_8()
       : MProc("X", "ND", {"Non-Diffractive", "N-cut soft Pomerons", "With TOY fragmentation"}) {}
   ~PROC_8() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) { return 1.0; }
+  double Amp2(gra::LORENTZSCALAR& lts) { return 1.0; }
 };
 
 // -----------------------------------------------------------------------
@@ -254,23 +313,11 @@ class PROC_9 : public MProc {
  public:
   PROC_9() : MProc("PP", "RES", {"Parametric resonance", "Pomeron"}) {}
   ~PROC_9() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitRegge(lts);
-    std::complex<double> A = 0.0;
 
     // Coherent sum of Resonances (loop over)
-    for (auto& x : lts.RESONANCES) {
-      const int J = static_cast<int>(x.second.p.spinX2 / 2.0);
-
-      // Gamma-Pomeron for vectors
-      if ((J % 2 != 0) && x.second.p.P == -1) {
-        A += Regge->PhotoME3(lts, x.second);
-      }
-      // Pomeron-Pomeron, J = 0,1,2,... all ok
-      else {
-        A += Regge->ME3(lts, x.second);
-      }
-    }
+    const std::complex<double> A = ResonanceSum(lts);
 
     // ------------------------------------------------------------------
     // Set for the screening loop
@@ -287,11 +334,9 @@ class PROC_10 : public MProc {
       : MProc("PP", "RESHEL",
               {"Sliding pomeron helicity amplitudes", "Pomeron", "DEVELOPER ONLY PROCESS!"}) {}
   ~PROC_10() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitRegge(lts);
-    std::complex<double> A = 0.0;
-    A                      = Regge->ME3HEL(lts, lts.RESONANCES.begin()->second);
-    return abs2(A);
+    return Regge->ME3HEL2(lts, lts.RESONANCES.begin()->second);
   }
 };
 
@@ -299,7 +344,7 @@ class PROC_11 : public MProc {
  public:
   PROC_11() : MProc("PP", "RESTENSOR", {"Parametric resonance", "Tensor Pomeron"}) {}
   ~PROC_11() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitTensor(lts);
     return Tensor->ME3(lts);
   }
@@ -309,7 +354,7 @@ class PROC_12 : public MProc {
  public:
   PROC_12() : MProc("PP", "CONTENSOR", {"Hadron continuum 2-body", "Tensor Pomeron"}) {}
   ~PROC_12() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitTensor(lts);
 
     if (!AssertN(2, lts.decaytree.size())) {
@@ -325,7 +370,7 @@ class PROC_13 : public MProc {
       : MProc("PP", "CONTENSOR24",
               {"Hadron continuum 2-body > 4-body", "Tensor Pomeron", "DEVELOPER ONLY PROCESS!"}) {}
   ~PROC_13() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitTensor(lts);
 
     if (!AssertN(2, lts.decaytree.size()) && !AssertN(4, lts.decaytree.size())) {
@@ -342,7 +387,7 @@ class PROC_14 : public MProc {
       : MProc("PP", "RES+CONTENSOR",
               {"Hadron resonances + continuum 2-body", "Tensor Pomeron / yP"}) {}
   ~PROC_14() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitTensor(lts);
 
     if (!AssertN(2, lts.decaytree.size())) {
@@ -352,9 +397,8 @@ class PROC_14 : public MProc {
     // 1. Evaluate continuum matrix element -> helicity amplitudes to lts.hamp
     Tensor->ME4(lts);
 
-    // Add to temp vector (init with zero!)
-    std::vector<std::complex<double>> tempsum(lts.hamp.size(), 0.0);
-    for (const auto& i : aux::indices(lts.hamp)) { tempsum[i] += lts.hamp[i]; }
+    // Copy to the member scratch buffer (capacity re-used between events)
+    tempsum.assign(lts.hamp.begin(), lts.hamp.end());
 
     // 2. Evaluate resonance matrix elements -> helicity amplitudes to lts.hamp
     if (lts.RESONANCES.size() != 0) {
@@ -363,18 +407,28 @@ class PROC_14 : public MProc {
       // Add to temp vector
       for (const auto& i : aux::indices(lts.hamp)) { tempsum[i] += lts.hamp[i]; }
     }
+
+    // Get total amplitude squared 1/4 \sum_h |A_h|^2 in one pass, with the
+    // complex modulus opened up so the reduction auto-vectorizes
+    double amp2 = 0.0;
+    for (const auto& i : aux::indices(tempsum)) {
+      const double re = std::real(tempsum[i]);
+      const double im = std::imag(tempsum[i]);
+      amp2 += re * re + im * im;
+    }
+    amp2 *= 0.25;  // Initial state helicity average
+
     // ------------------------------------------------------------------
     // Set helicity amplitudes for the screening loop
     lts.hamp = tempsum;
     // ------------------------------------------------------------------
 
-    // Get total amplitude squared 1/4 \sum_h |A_h|^2
-    double amp2 = 0.0;
-    for (const auto& i : aux::indices(lts.hamp)) { amp2 += gra::math::abs2(lts.hamp[i]); }
-    amp2 /= 4;  // Initial state helicity average
-
     return amp2;
   }
+
+ private:
+  // Scratch for the continuum + resonance helicity amplitude sum
+  std::vector<std::complex<double>> tempsum;
 };
 
 
@@ -382,21 +436,36 @@ class PROC_15 : public MProc {
  public:
   PROC_15() : MProc("PP", "CON", {"Hadron continuum 2/4/6-body", "Pomeron"}) {}
   ~PROC_15() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitRegge(lts);
 
+    // Resolve the multiplicity once (it is fixed within a run)
+    if (nbody == 0) {
+      const std::size_t N = lts.decaytree.size();
+      if (N != 2 && N != 4 && N != 6) {
+        throw std::invalid_argument(ISTATE + "[" + CHANNEL +
+                                    "] requires 2, 4 or 6-body final state");
+      }
+      nbody = static_cast<int>(N);
+    }
+
     std::complex<double> A = 0.0;
-    if (AssertN(2, lts.decaytree.size())) {
-      A = Regge->ME4(lts, 1);
-    } else if (AssertN(4, lts.decaytree.size())) {
-      A = Regge->ME6(lts);
-    } else if (AssertN(6, lts.decaytree.size())) {
-      A = Regge->ME8(lts);
-    } else {
-      throw std::invalid_argument(ISTATE + "[" + CHANNEL + "] requires 2, 4 or 6-body final state");
+    switch (nbody) {
+      case 2:
+        A = Regge->ME4(lts, 1);
+        break;
+      case 4:
+        A = Regge->ME6(lts);
+        break;
+      default:
+        A = Regge->ME8(lts);
+        break;
     }
     return abs2(A);
   }
+
+ private:
+  int nbody = 0;  // Final state multiplicity (0 = unresolved)
 };
 
 
@@ -406,7 +475,7 @@ class PROC_16 : public MProc {
       : MProc("PP", "CON-",
               {"Hadron continuum 2-body with [t-u] amp.", "Pomeron", "AMPLITUDE SIGN FLIP!"}) {}
   ~PROC_16() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitRegge(lts);
 
     if (!AssertN(2, lts.decaytree.size())) {
@@ -422,7 +491,7 @@ class PROC_17 : public MProc {
  public:
   PROC_17() : MProc("PP", "RES+CON", {"Hadron resonances + continuum 2-body", "Pomeron / yP"}) {}
   ~PROC_17() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitRegge(lts);
     std::complex<double> A = 0.0;
 
@@ -434,18 +503,7 @@ class PROC_17 : public MProc {
     A = Regge->ME4(lts, 1);
 
     // 2. Coherent sum of Resonances (loop over)
-    for (auto& x : lts.RESONANCES) {
-      const int J = static_cast<int>(x.second.p.spinX2 / 2.0);
-
-      // Gamma-Pomeron for vectors
-      if ((J % 2 != 0) && x.second.p.P == -1) {
-        A += Regge->PhotoME3(lts, x.second);
-      }
-      // Pomeron-Pomeron, J = 0,1,2,... all ok
-      else {
-        A += Regge->ME3(lts, x.second);
-      }
-    }
+    A += ResonanceSum(lts);
 
     // ------------------------------------------------------------------
     // Set helicity amplitudes for the screening loop
@@ -464,18 +522,15 @@ class PROC_18 : public MProc {
  public:
   PROC_18() : MProc("yP", "RES", {"Photoproduced resonance", "kt-EPA x Pomeron"}) {}
   ~PROC_18() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitRegge(lts);
+    PartitionResonances(lts);
     std::complex<double> A = 0.0;
 
     // Coherent sum of Resonances (loop over)
-    for (auto& x : lts.RESONANCES) {
-      const int J = static_cast<int>(x.second.p.spinX2 / 2.0);
-
-      // Gamma-Pomeron for vectors
-      if ((J % 2 != 0) && x.second.p.P == -1) {
-        A += Regge->PhotoME3(lts, lts.RESONANCES.begin()->second);
-      }
+    // Gamma-Pomeron for vectors (as before, always the first resonance)
+    for (std::size_t i = 0; i < reso_vector_odd.size(); ++i) {
+      A += Regge->PhotoME3(lts, lts.RESONANCES.begin()->second);
     }
     return abs2(A);  // amplitude squared
   }
@@ -485,7 +540,7 @@ class PROC_19 : public MProc {
  public:
   PROC_19() : MProc("yP", "RESTENSOR", {"Photoproduced resonance", "QED x Tensor Pomeron"}) {}
   ~PROC_19() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitTensor(lts);
     return Tensor->ME3(lts);
   }
@@ -496,16 +551,13 @@ class PROC_20 : public MProc {
  public:
   PROC_20() : MProc("OP", "RES", {"Oddproduced resonance", "Odderon x Pomeron"}) {}
   ~PROC_20() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitRegge(lts);
+    PartitionResonances(lts);
     std::complex<double> A = 0.0;
     // Coherent sum of Resonances (loop over)
-    for (auto& x : lts.RESONANCES) {
-      const int J = static_cast<int>(x.second.p.spinX2 / 2.0);
-
-      // Vectors J=1,3,5,...
-      if ((J % 2 != 0) && x.second.p.P == -1) { A += Regge->ME3ODD(lts, x.second); }
-    }
+    // Vectors J=1,3,5,...
+    for (auto* x : reso_vector_odd) { A += Regge->ME3ODD(lts, *x); }
     return abs2(A);  // amplitude squared
   }
 };
@@ -519,7 +571,7 @@ class PROC_21 : public MProc {
  public:
   PROC_21() : MProc("gg", "chic(0)", {"QCD resonance chic(0)", "Durham QCD"}) {}
   ~PROC_21() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitDurham(lts);
     double amp2 = 0.0;
     amp2        = Durham->DurhamQCD(lts, CHANNEL);
@@ -533,19 +585,25 @@ class PROC_22 : public MProc {
       : MProc("gg", "CON",
               {"QCD continuum gg, 2 x pseudoscalar", "Durham QCD", "UNDER VALIDATION!"}) {}
   ~PROC_22() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitDurham(lts);
 
-    double amp2 = 0.0;
-    if (AssertN({21, 21}, PDGlist(lts))) {
-      amp2 = Durham->DurhamQCD(lts, "gg");
-    } else if (AssertN(2, lts.decaytree.size())) {
-      amp2 = Durham->DurhamQCD(lts, "MMbar");
-    } else {
-      ThrowUnknownFinalState();
+    // Resolve the final state branch once (it is fixed within a run)
+    if (gg_mode == 0) {
+      if (AssertN({21, 21}, PDGlist(lts))) {
+        gg_mode = 1;
+      } else if (AssertN(2, lts.decaytree.size())) {
+        gg_mode = 2;
+      } else {
+        ThrowUnknownFinalState();
+      }
     }
-    return amp2;
+    static const std::string GG = "gg", MMBAR = "MMbar";
+    return Durham->DurhamQCD(lts, (gg_mode == 1) ? GG : MMBAR);
   }
+
+ private:
+  int gg_mode = 0;  // Final state (0 = unresolved, 1 = gg, 2 = MMbar)
 };
 
 class PROC_23 : public MProc {
@@ -553,7 +611,7 @@ class PROC_23 : public MProc {
   PROC_23()
       : MProc("gg", "FLUX", {"Durham flux with |A|^2 = 1", "Durham QCD", "SYSTEM TEST PROCESS!"}) {}
   ~PROC_23() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitDurham(lts);
 
     return Durham->DurhamQCD(lts, "FLUX");
@@ -570,7 +628,7 @@ class PROC_24 : public MProc {
   PROC_24()
       : MProc("yy_LUX", "CON", {"Continuum l+l, qqbar, W+W-, monopolepair", "Collinear LUX-PDF"}) {}
   ~PROC_24() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitGamma(lts);
     double amp2 = GammaGammaCON(lts);
     return flux::ApplyLUXfluxes(amp2, lts);
@@ -583,7 +641,7 @@ class PROC_25 : public MProc {
       : MProc("yy_DZ", "CON",
               {"Continuum l+l, qqbar, W+W-, monopolepair", "Collinear Drees-Zeppenfeld EPA"}) {}
   ~PROC_25() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitGamma(lts);
     double amp2 = GammaGammaCON(lts);
     return flux::ApplyDZfluxes(amp2, lts);
@@ -595,7 +653,7 @@ class PROC_26 : public MProc {
   PROC_26()
       : MProc("yy", "FLUX", {"kt-EPA flux with |A|^2 = 1", "kt-EPA", "SYSTEM TEST PROCESS!"}) {}
   ~PROC_26() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitGamma(lts);
     double amp2 = 1.0;
     return flux::ApplyktEPAfluxes(amp2, lts);
@@ -609,7 +667,7 @@ class PROC_27 : public MProc {
             "yy_DZ", "FLUX",
             {"DZ flux with |A|^2 = 1", "Collinear Drees-Zeppenfeld EPA", "SYSTEM TEST PROCESS!"}) {}
   ~PROC_27() {}
-  virtual double Amp2(gra::LORENTZSCALAR& lts) {
+  double Amp2(gra::LORENTZSCALAR& lts) {
     InitGamma(lts);
     double amp2 = 1.0;
     return flux::ApplyDZfluxes(amp2, lts);
@@ -617,6 +675,27 @@ class PROC_27 : public MProc {
 };
 
 
+// Closed set of concrete processes, dispatched by std::visit without any
+// virtual call per event; std::monostate marks "not yet activated"
+using ProcessVariant =
+    std::variant<std::monostate, PROC_0, PROC_1, PROC_2, PROC_3, PROC_4, PROC_5, PROC_6, PROC_7,
+                 PROC_8, PROC_9, PROC_10, PROC_11, PROC_12, PROC_13, PROC_14, PROC_15, PROC_16,
+                 PROC_17, PROC_18, PROC_19, PROC_20, PROC_21, PROC_22, PROC_23, PROC_24, PROC_25,
+                 PROC_26, PROC_27>;
+
+// Access the common MProc base of an activated variant
+inline const MProc& ProcessBase(const ProcessVariant& v) {
+  return std::visit(
+      [](const auto& proc) -> const MProc& {
+        if constexpr (std::is_same_v<std::decay_t<decltype(proc)>, std::monostate>) {
+          throw std::logic_error("gra::ProcessBase: process not initialized");
+        } else {
+          return static_cast<const MProc&>(proc);
+        }
+      },
+      v);
+}
+
 // Umbrella class
 class MSubProc {
  public:
@@ -639,20 +718,26 @@ class MSubProc {
   std::string  ISTATE;       // "PP","yy","gg" etc.
   std::string  CHANNEL;      // "CON", "RES" etc.
   unsigned int LIPSDIM = 0;  // Lorentz Invariant Phase Space Dimension
-  std::map<std::string, std::vector<std::string>> Processes;  // Process descriptions
 
-  double                              GetBareAmplitude2(gra::LORENTZSCALAR& lts);
-  bool                                ProcessExist(std::string process) const;
-  std::vector<std::string>            PrintProcesses() const;
-  std::vector<std::shared_ptr<MProc>> CreateAllProcesses() const;
-  std::vector<std::string>            GetProcessDescriptor(std::string process) const;
+  // Process descriptions as a flat (name, description) table kept sorted by
+  // name, so lookups are a binary search without tree node chasing
+  using ProcessTable = std::vector<std::pair<std::string, std::vector<std::string>>>;
+  ProcessTable Processes;
+
+  double                      GetBareAmplitude2(gra::LORENTZSCALAR& lts);
+  bool                        ProcessExist(std::string process) const;
+  std::vector<std::string>    PrintProcesses() const;
+  std::vector<ProcessVariant> CreateAllProcesses() const;
+  std::vector<std::string>    GetProcessDescriptor(std::string process) const;
 
  private:
   void ConstructDescriptions(const std::string& istate, const std::string& mc);
+  ProcessTable::const_iterator FindProcess(const std::string& process) const;
   void ActivateProcess();
+  bool TryActivateProcess();
 
-  // shared_ptr because of multithreading support!
-  std::shared_ptr<MProc> pr = nullptr;
+  // Value semantics: process copies (e.g. per thread) each own their state
+  ProcessVariant pr;
 };
 
 
@@ -96,14 +96,8 @@ double AMP_MG5_gg_gg::CalcAmp2(gra::LORENTZSCALAR &lts, double alphas) {
   }
   // @@@@@@@@@@@@@@@@@@@@@@@@@@ GRANIITTI @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
   const int ncomb = 16;
-  lts.hamp        = std::vector<std::complex<double>>(ncomb);  // GRANIITTI
-
-  static bool            goodhel[ncomb] = {ncomb * false};
-  static int             ntry = 0, sum_hel = 0, ngood = 0;
-  static int             igood[ncomb];
-  static int             jhel;
-  std::complex<double> **wfs;
-  double                 t[nprocesses];
+  lts.hamp.assign(ncomb, 0.0);  // GRANIITTI: re-uses capacity, no per-call allocation
+
   // Helicities for the process
   static const int helicities[ncomb][nexternal] = {
       {-1, -1, -1, -1}, {-1, -1, -1, 1}, {-1, -1, 1, -1}, {-1, -1, 1, 1},
@@ -111,9 +105,7 @@ double AMP_MG5_gg_gg::CalcAmp2(gra::LORENTZSCALAR &lts, double alphas) {
       {1, -1, -1, -1},  {1, -1, -1, 1},  {1, -1, 1, -1},  {1, -1, 1, 1},
       {1, 1, -1, -1},   {1, 1, -1, 1},   {1, 1, 1, -1},   {1, 1, 1, 1}};
   // Denominators: spins, colors and identical particles
-  const int denominators[nprocesses] = {512};
-
-  ntry = 1;  // GRANIITTI
+  constexpr double kInvDenom = 1.0 / 512;
 
   // Reset the matrix elements
   for (int i = 0; i < nprocesses; i++) { matrix_element[i] = 0.; }
@@ -121,50 +113,10 @@ double AMP_MG5_gg_gg::CalcAmp2(gra::LORENTZSCALAR &lts, double alphas) {
   int perm[nexternal];
   for (int i = 0; i < nexternal; i++) { perm[i] = i; }
 
-  goto SKIPLABEL;  // GRANIITTI: Skip this block
-  if (sum_hel == 0 || ntry < 10) {
-    // Calculate the matrix element for all helicities
-    for (int ihel = 0; ihel < ncomb; ihel++) {
-      if (goodhel[ihel] || ntry < 2) {
-        calculate_wavefunctions(perm, helicities[ihel]);
-        t[0] = matrix_1_gg_gg();
-
-        double tsum = 0;
-        for (int iproc = 0; iproc < nprocesses; iproc++) {
-          matrix_element[iproc] += t[iproc];
-          tsum += t[iproc];
-        }
-        // Store which helicities give non-zero result
-        if (tsum != 0. && !goodhel[ihel]) {
-          goodhel[ihel] = true;
-          ngood++;
-          igood[ngood] = ihel;
-        }
-      }
-    }
-    jhel    = 0;
-    sum_hel = min(sum_hel, ngood);
-  } else {
-    // Only use the "good" helicities
-    for (int j = 0; j < sum_hel; j++) {
-      jhel++;
-      if (jhel >= ngood) jhel = 0;
-      double hwgt = double(ngood) / double(sum_hel);
-      int    ihel = igood[jhel];
-      calculate_wavefunctions(perm, helicities[ihel]);
-      t[0] = matrix_1_gg_gg();
-
-      for (int iproc = 0; iproc < nprocesses; iproc++) { matrix_element[iproc] += t[iproc] * hwgt; }
-    }
-  }
+  // Evaluate both helicity variants of every external wavefunction once
+  precompute_external(perm);
 
-  for (int i = 0; i < nprocesses; i++) matrix_element[i] /= denominators[i];
 
-SKIPLABEL:
-
-  // @@@@@@@@@@@@@@@@@@@@@@@@@@ GRANIITTI @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-  // Define permutation
-  for (int i = 0; i < nexternal; ++i) { perm[i] = i; }
 
   // Loop over helicity combinations
   for (int ihel = 0; ihel < ncomb; ++ihel) {
@@ -177,7 +129,7 @@ SKIPLABEL:
   // Total amplitude squared over all helicity combinations individually
   double amp2 = 0.0;
   for (int ihel = 0; ihel < ncomb; ++ihel) { amp2 += gra::math::abs2(lts.hamp[ihel]); }
-  amp2 /= denominators[0];  // spin average matrix element squared
+  amp2 *= kInvDenom;  // spin average matrix element squared
 
   return amp2;  // amplitude squared
                 // @@@@@@@@@@@@@@@@@@@@@@@@@@ GRANIITTI @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
@@ -203,15 +155,25 @@ double AMP_MG5_gg_gg::sigmaHat() {
 //--------------------------------------------------------------------------
 // Evaluate |M|^2 for each subprocess
 
+// External wavefunctions for both helicities of every leg, evaluated once
+// per phase-space point; the helicity loop then only block-copies them
+void AMP_MG5_gg_gg::precompute_external(const int perm[]) {
+  for (int i = 0; i < nexternal; ++i) {
+    const int nsv = (i < ninitial) ? -1 : +1;
+    vxxxxx(p[perm[i]], mME[i], -1, nsv, wext[i][0]);
+    vxxxxx(p[perm[i]], mME[i], +1, nsv, wext[i][1]);
+  }
+}
+
 void AMP_MG5_gg_gg::calculate_wavefunctions(const int perm[], const int hel[]) {
   // Calculate wavefunctions for all processes
   int i, j;
 
-  // Calculate all wavefunctions
-  vxxxxx(p[perm[0]], mME[0], hel[0], -1, w[0]);
-  vxxxxx(p[perm[1]], mME[1], hel[1], -1, w[1]);
-  vxxxxx(p[perm[2]], mME[2], hel[2], +1, w[2]);
-  vxxxxx(p[perm[3]], mME[3], hel[3], +1, w[3]);
+  // External wavefunctions were precomputed for both helicities per leg
+  for (i = 0; i < nexternal; ++i) {
+    const std::complex<double> *src = wext[i][(hel[i] + 1) / 2];
+    std::copy(src, src + 6, w[i]);
+  }
   VVV1P0_1(w[0], w[1], pars.GC_10, pars.ZERO, pars.ZERO, w[4]);
   VVV1P0_1(w[0], w[2], pars.GC_10, pars.ZERO, pars.ZERO, w[5]);
   VVV1P0_1(w[0], w[3], pars.GC_10, pars.ZERO, pars.ZERO, w[6]);
@@ -230,7 +192,6 @@ double AMP_MG5_gg_gg::matrix_1_gg_gg() {
   // Local variables
   const int            ngraphs = 6;
   const int            ncolor  = 6;
-  std::complex<double> ztemp;
   std::complex<double> jamp[ncolor];
   // The color matrix;
   static const double denom[ncolor]      = {6, 6, 6, 6, 6, 6};
@@ -246,13 +207,15 @@ double AMP_MG5_gg_gg::matrix_1_gg_gg() {
   jamp[4] = +2. * (-amp[2] - amp[1] - amp[4] - amp[5]);
   jamp[5] = +2. * (+amp[2] - amp[0] - amp[3] + amp[5]);
 
-  // Sum and square the color flows to get the matrix element
+  // Sum and square the color flows to get the matrix element. The color
+  // matrix is symmetric, so only the upper triangle is visited: diagonal
+  // terms once, each off-diagonal pair folded into twice its real part
   double matrix = 0;
   for (i = 0; i < ncolor; i++) {
-    ztemp = 0.;
-    for (j = 0; j < ncolor; j++) ztemp = ztemp + cf[i][j] * jamp[j];
-    matrix = matrix + real(ztemp * conj(jamp[i])) / denom[i];
+    matrix += cf[i][i] * real(jamp[i] * conj(jamp[i]));
+    for (j = i + 1; j < ncolor; j++) { matrix += 2. * cf[i][j] * real(jamp[i] * conj(jamp[j])); }
   }
+  matrix /= denom[0];  // common color denominator
 
   // Store the leading color flows for choice of color
   for (i = 0; i < ncolor; i++) jamp2[0][i] += real(jamp[i] * conj(jamp[i]));
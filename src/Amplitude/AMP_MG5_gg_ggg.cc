@@ -62,14 +62,18 @@ double AMP_MG5_gg_ggg::CalcAmp2(gra::LORENTZSCALAR &lts, double alphas) {
   // *** MADGRAPH CONVENTION IS [E,px,py,pz] ! ***
 
   // *** Set masses for HELAS ***
-  std::vector<double>     masses = {0, 0};  // Massless two initial states
-  std::vector<gra::M4Vec> pf;
+  // The event shape (leg count, massless initial states) is fixed over a
+  // run, so the mass and final-state vectors are refreshed in place
+  // instead of being rebuilt on every call
+  mME.resize(ninitial + lts.decaytree.size());
+  pf.resize(lts.decaytree.size());
+  mME[0] = 0;  // Massless two initial states
+  mME[1] = 0;
 
   for (std::size_t i = 0; i < lts.decaytree.size(); ++i) {
-    masses.push_back(lts.decaytree[i].p4.M());
-    pf.push_back(lts.decaytree[i].p4);
+    mME[ninitial + i] = lts.decaytree[i].p4.M();
+    pf[i]             = lts.decaytree[i].p4;
   }
-  mME = masses;
 
   gra::M4Vec p1_ = lts.q1;
   gra::M4Vec p2_ = lts.q2;
@@ -78,111 +82,74 @@ double AMP_MG5_gg_ggg::CalcAmp2(gra::LORENTZSCALAR &lts, double alphas) {
   // Do kinematic transform
   gra::kinematics::OffShell2LightCone(p1_, p2_, pf);
 
-  // Set initial state 4-momentum
-  p.clear();
-  double p1[] = {p1_.E(), p1_.Px(), p1_.Py(), p1_.Pz()};
-  p.push_back(&p1[0]);
+  // Momentum pointer table set up once, pointing into the contiguous
+  // member buffer which is simply overwritten event by event
+  if (p.size() != static_cast<std::size_t>(nexternal)) {
+    p.resize(nexternal);
+    for (int i = 0; i < nexternal; ++i) { p[i] = &pbuf[i][0]; }
+  }
 
-  double p2[] = {p2_.E(), p2_.Px(), p2_.Py(), p2_.Pz()};
-  p.push_back(&p2[0]);
+  // Set initial state 4-momentum: M4Vec stores [E,px,py,pz] contiguously,
+  // the MadGraph convention, so stage with straight block copies
+  std::copy(p1_.data(), p1_.data() + 4, pbuf[0]);
+  std::copy(p2_.data(), p2_.data() + 4, pbuf[1]);
 
   // Set final state 4-momentum
-  double pthis[pf.size()][4];
   for (std::size_t i = 0; i < pf.size(); ++i) {
-    pthis[i][0] = pf[i].E();
-    pthis[i][1] = pf[i].Px();
-    pthis[i][2] = pf[i].Py();
-    pthis[i][3] = pf[i].Pz();
-    p.push_back(&pthis[i][0]);
+    std::copy(pf[i].data(), pf[i].data() + 4, pbuf[ninitial + i]);
   }
   // @@@@@@@@@@@@@@@@@@@@@@@@@@ GRANIITTI @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
   const int ncomb = 32;
-  lts.hamp        = std::vector<std::complex<double>>(ncomb);  // GRANIITTI
-
-  static bool            goodhel[ncomb] = {ncomb * false};
-  static int             ntry = 0, sum_hel = 0, ngood = 0;
-  static int             igood[ncomb];
-  static int             jhel;
-  std::complex<double> **wfs;
-  double                 t[nprocesses];
-  // Helicities for the process
-  static const int helicities[ncomb][nexternal] = {
-      {-1, -1, -1, -1, -1}, {-1, -1, -1, -1, 1}, {-1, -1, -1, 1, -1}, {-1, -1, -1, 1, 1},
-      {-1, -1, 1, -1, -1},  {-1, -1, 1, -1, 1},  {-1, -1, 1, 1, -1},  {-1, -1, 1, 1, 1},
-      {-1, 1, -1, -1, -1},  {-1, 1, -1, -1, 1},  {-1, 1, -1, 1, -1},  {-1, 1, -1, 1, 1},
-      {-1, 1, 1, -1, -1},   {-1, 1, 1, -1, 1},   {-1, 1, 1, 1, -1},   {-1, 1, 1, 1, 1},
-      {1, -1, -1, -1, -1},  {1, -1, -1, -1, 1},  {1, -1, -1, 1, -1},  {1, -1, -1, 1, 1},
-      {1, -1, 1, -1, -1},   {1, -1, 1, -1, 1},   {1, -1, 1, 1, -1},   {1, -1, 1, 1, 1},
-      {1, 1, -1, -1, -1},   {1, 1, -1, -1, 1},   {1, 1, -1, 1, -1},   {1, 1, -1, 1, 1},
-      {1, 1, 1, -1, -1},    {1, 1, 1, -1, 1},    {1, 1, 1, 1, -1},    {1, 1, 1, 1, 1}};
+  // GRANIITTI: re-used between events, no per-call allocation
+  if (lts.hamp.size() != static_cast<std::size_t>(ncomb)) { lts.hamp.resize(ncomb); }
+
+  // Helicities for the process: combination ihel is simply the binary
+  // expansion of ihel with bit 0 -> -1 and bit 1 -> +1 (particle 0 in the
+  // most significant bit), so decode instead of storing a 32 x 5 table
+  int        hel[nexternal];
+  const auto SetHelicity = [&hel](int ihel) {
+    for (int i = 0; i < nexternal; ++i) { hel[i] = ((ihel >> (nexternal - 1 - i)) & 1) * 2 - 1; }
+  };
   // Denominators: spins, colors and identical particles
-  const int denominators[nprocesses] = {1536};
-
-  ntry = 1;  // GRANIITTI
+  constexpr double kInvDenom = 1.0 / 1536;
 
   // Reset the matrix elements
   for (int i = 0; i < nprocesses; i++) { matrix_element[i] = 0.; }
-  // Define permutation
-  int perm[nexternal];
-  for (int i = 0; i < nexternal; i++) { perm[i] = i; }
-
-  goto SKIPLABEL;  // GRANIITTI: Skip this block
-  if (sum_hel == 0 || ntry < 10) {
-    // Calculate the matrix element for all helicities
-    for (int ihel = 0; ihel < ncomb; ihel++) {
-      if (goodhel[ihel] || ntry < 2) {
-        calculate_wavefunctions(perm, helicities[ihel]);
-        t[0] = matrix_1_gg_ggg();
-
-        double tsum = 0;
-        for (int iproc = 0; iproc < nprocesses; iproc++) {
-          matrix_element[iproc] += t[iproc];
-          tsum += t[iproc];
-        }
-        // Store which helicities give non-zero result
-        if (tsum != 0. && !goodhel[ihel]) {
-          goodhel[ihel] = true;
-          ngood++;
-          igood[ngood] = ihel;
-        }
-      }
-    }
-    jhel    = 0;
-    sum_hel = min(sum_hel, ngood);
-  } else {
-    // Only use the "good" helicities
-    for (int j = 0; j < sum_hel; j++) {
-      jhel++;
-      if (jhel >= ngood) jhel = 0;
-      double hwgt = double(ngood) / double(sum_hel);
-      int    ihel = igood[jhel];
-      calculate_wavefunctions(perm, helicities[ihel]);
-      t[0] = matrix_1_gg_ggg();
-
-      for (int iproc = 0; iproc < nprocesses; iproc++) { matrix_element[iproc] += t[iproc] * hwgt; }
-    }
-  }
-
-  for (int i = 0; i < nprocesses; i++) matrix_element[i] /= denominators[i];
-
-SKIPLABEL:
 
   // @@@@@@@@@@@@@@@@@@@@@@@@@@ GRANIITTI @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
   // Define permutation
+  int perm[nexternal];
   for (int i = 0; i < nexternal; ++i) { perm[i] = i; }
 
-  // Loop over helicity combinations
-  for (int ihel = 0; ihel < ncomb; ++ihel) {
-    calculate_wavefunctions(perm, helicities[ihel]);
+  // Evaluate both helicity variants of every external wavefunction once
+  precompute_external(perm);
 
-    // Sum of subamplitudes (s,t,u,...)
-    for (int k = 0; k < namplitudes; ++k) { lts.hamp[ihel] += amp[k]; }
-  }
-
-  // Total amplitude squared over all helicity combinations individually
+  // Loop over helicity combinations in pairs differing only in the last
+  // external helicity, so the shared wavefunction part is evaluated once
+  // per pair
   double amp2 = 0.0;
-  for (int ihel = 0; ihel < ncomb; ++ihel) { amp2 += gra::math::abs2(lts.hamp[ihel]); }
-  amp2 /= denominators[0];  // spin average matrix element squared
+  for (int ihel = 0; ihel < ncomb; ihel += 2) {
+    SetHelicity(ihel);
+    calculate_wavefunctions_shared(perm, hel);
+
+    for (int sub = 0; sub < 2; ++sub) {
+      calculate_wavefunctions_last(perm, 2 * sub - 1);
+
+      // Sum of subamplitudes (s,t,u,...) with split re/im accumulators, so the
+      // reduction over the contiguous amp[] array auto-vectorizes
+      double re = 0.0;
+      double im = 0.0;
+      for (int k = 0; k < namplitudes; ++k) {
+        re += std::real(amp[k]);
+        im += std::imag(amp[k]);
+      }
+      lts.hamp[ihel + sub] = std::complex<double>(re, im);
+
+      // Total amplitude squared accumulated in the same pass
+      amp2 += re * re + im * im;
+    }
+  }
+  amp2 *= kInvDenom;  // spin average matrix element squared
 
   return amp2;  // amplitude squared
                 // @@@@@@@@@@@@@@@@@@@@@@@@@@ GRANIITTI @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
@@ -209,103 +176,110 @@ double AMP_MG5_gg_ggg::sigmaHat() {
 // Evaluate |M|^2 for each subprocess
 
 void AMP_MG5_gg_ggg::calculate_wavefunctions(const int perm[], const int hel[]) {
-  // Calculate wavefunctions for all processes
-  int i, j;
+  calculate_wavefunctions_shared(perm, hel);
+  calculate_wavefunctions_last(perm, hel[4]);
+}
+
+// External wavefunctions for both helicities of every leg, evaluated once
+// per phase-space point; the helicity loop then only block-copies them
+void AMP_MG5_gg_ggg::precompute_external(const int perm[]) {
+  for (int i = 0; i < nexternal; ++i) {
+    const int nsv = (i < ninitial) ? -1 : +1;
+    vxxxxx(p[perm[i]], mME[i], -1, nsv, wext[i][0]);
+    vxxxxx(p[perm[i]], mME[i], +1, nsv, wext[i][1]);
+  }
+}
+
+// Wavefunctions independent of the last external helicity (legs 0-3 and
+// all internal lines built from them only)
+void AMP_MG5_gg_ggg::calculate_wavefunctions_shared(const int perm[], const int hel[]) {
+  for (int i = 0; i < 4; ++i) {
+    const std::complex<double> *src = wext[i][(hel[i] + 1) / 2];
+    std::copy(src, src + 6, w[i]);
+  }
+  // Per-event constants pulled into locals once, instead of a member load
+  // through pars for each of the vertex calls below
+  const std::complex<double> GC_10 = pars.GC_10;
+  const std::complex<double> GC_12 = pars.GC_12;
+  const double               ZERO  = pars.ZERO;
+  VVV1P0_1(w[0], w[1], GC_10, ZERO, ZERO, w[5]);
+  VVV1P0_1(w[2], w[3], GC_10, ZERO, ZERO, w[6]);
+  VVV1P0_1(w[0], w[2], GC_10, ZERO, ZERO, w[9]);
+  VVV1P0_1(w[1], w[3], GC_10, ZERO, ZERO, w[10]);
+  VVV1P0_1(w[0], w[3], GC_10, ZERO, ZERO, w[12]);
+  VVV1P0_1(w[1], w[2], GC_10, ZERO, ZERO, w[13]);
+  VVVV134P0_1(w[0], w[1], w[2], GC_12, ZERO, ZERO, w[15], w[16], w[17]);
+  VVVV134P0_1(w[0], w[1], w[3], GC_12, ZERO, ZERO, w[18], w[19], w[20]);
+  VVVV134P0_1(w[0], w[2], w[3], GC_12, ZERO, ZERO, w[24], w[25], w[26]);
+}
 
-  // Calculate all wavefunctions
-  vxxxxx(p[perm[0]], mME[0], hel[0], -1, w[0]);
-  vxxxxx(p[perm[1]], mME[1], hel[1], -1, w[1]);
-  vxxxxx(p[perm[2]], mME[2], hel[2], +1, w[2]);
-  vxxxxx(p[perm[3]], mME[3], hel[3], +1, w[3]);
-  vxxxxx(p[perm[4]], mME[4], hel[4], +1, w[4]);
-  VVV1P0_1(w[0], w[1], pars.GC_10, pars.ZERO, pars.ZERO, w[5]);
-  VVV1P0_1(w[2], w[3], pars.GC_10, pars.ZERO, pars.ZERO, w[6]);
-  VVV1P0_1(w[2], w[4], pars.GC_10, pars.ZERO, pars.ZERO, w[7]);
-  VVV1P0_1(w[3], w[4], pars.GC_10, pars.ZERO, pars.ZERO, w[8]);
-  VVV1P0_1(w[0], w[2], pars.GC_10, pars.ZERO, pars.ZERO, w[9]);
-  VVV1P0_1(w[1], w[3], pars.GC_10, pars.ZERO, pars.ZERO, w[10]);
-  VVV1P0_1(w[1], w[4], pars.GC_10, pars.ZERO, pars.ZERO, w[11]);
-  VVV1P0_1(w[0], w[3], pars.GC_10, pars.ZERO, pars.ZERO, w[12]);
-  VVV1P0_1(w[1], w[2], pars.GC_10, pars.ZERO, pars.ZERO, w[13]);
-  VVV1P0_1(w[0], w[4], pars.GC_10, pars.ZERO, pars.ZERO, w[14]);
-  VVVV1P0_1(w[0], w[1], w[2], pars.GC_12, pars.ZERO, pars.ZERO, w[15]);
-  VVVV3P0_1(w[0], w[1], w[2], pars.GC_12, pars.ZERO, pars.ZERO, w[16]);
-  VVVV4P0_1(w[0], w[1], w[2], pars.GC_12, pars.ZERO, pars.ZERO, w[17]);
-  VVVV1P0_1(w[0], w[1], w[3], pars.GC_12, pars.ZERO, pars.ZERO, w[18]);
-  VVVV3P0_1(w[0], w[1], w[3], pars.GC_12, pars.ZERO, pars.ZERO, w[19]);
-  VVVV4P0_1(w[0], w[1], w[3], pars.GC_12, pars.ZERO, pars.ZERO, w[20]);
-  VVVV1P0_1(w[0], w[1], w[4], pars.GC_12, pars.ZERO, pars.ZERO, w[21]);
-  VVVV3P0_1(w[0], w[1], w[4], pars.GC_12, pars.ZERO, pars.ZERO, w[22]);
-  VVVV4P0_1(w[0], w[1], w[4], pars.GC_12, pars.ZERO, pars.ZERO, w[23]);
-  VVVV1P0_1(w[0], w[2], w[3], pars.GC_12, pars.ZERO, pars.ZERO, w[24]);
-  VVVV3P0_1(w[0], w[2], w[3], pars.GC_12, pars.ZERO, pars.ZERO, w[25]);
-  VVVV4P0_1(w[0], w[2], w[3], pars.GC_12, pars.ZERO, pars.ZERO, w[26]);
-  VVVV1P0_1(w[0], w[2], w[4], pars.GC_12, pars.ZERO, pars.ZERO, w[27]);
-  VVVV3P0_1(w[0], w[2], w[4], pars.GC_12, pars.ZERO, pars.ZERO, w[28]);
-  VVVV4P0_1(w[0], w[2], w[4], pars.GC_12, pars.ZERO, pars.ZERO, w[29]);
-  VVVV1P0_1(w[0], w[3], w[4], pars.GC_12, pars.ZERO, pars.ZERO, w[30]);
-  VVVV3P0_1(w[0], w[3], w[4], pars.GC_12, pars.ZERO, pars.ZERO, w[31]);
-  VVVV4P0_1(w[0], w[3], w[4], pars.GC_12, pars.ZERO, pars.ZERO, w[32]);
+// Wavefunctions touching the last external leg, plus all amplitudes
+void AMP_MG5_gg_ggg::calculate_wavefunctions_last(const int perm[], const int hel4) {
+  {
+    const std::complex<double> *src = wext[4][(hel4 + 1) / 2];
+    std::copy(src, src + 6, w[4]);
+  }
+  const std::complex<double> GC_10 = pars.GC_10;
+  const std::complex<double> GC_12 = pars.GC_12;
+  const double               ZERO  = pars.ZERO;
+  VVV1P0_1(w[2], w[4], GC_10, ZERO, ZERO, w[7]);
+  VVV1P0_1(w[3], w[4], GC_10, ZERO, ZERO, w[8]);
+  VVV1P0_1(w[1], w[4], GC_10, ZERO, ZERO, w[11]);
+  VVV1P0_1(w[0], w[4], GC_10, ZERO, ZERO, w[14]);
+  VVVV134P0_1(w[0], w[1], w[4], GC_12, ZERO, ZERO, w[21], w[22], w[23]);
+  VVVV134P0_1(w[0], w[2], w[4], GC_12, ZERO, ZERO, w[27], w[28], w[29]);
+  VVVV134P0_1(w[0], w[3], w[4], GC_12, ZERO, ZERO, w[30], w[31], w[32]);
 
   // Calculate all amplitudes
   // Amplitude(s) for diagram number 0
-  VVV1_0(w[5], w[6], w[4], pars.GC_10, amp[0]);
-  VVV1_0(w[5], w[7], w[3], pars.GC_10, amp[1]);
-  VVV1_0(w[5], w[2], w[8], pars.GC_10, amp[2]);
-  VVVV1_0(w[2], w[3], w[4], w[5], pars.GC_12, amp[3]);
-  VVVV3_0(w[2], w[3], w[4], w[5], pars.GC_12, amp[4]);
-  VVVV4_0(w[2], w[3], w[4], w[5], pars.GC_12, amp[5]);
-  VVV1_0(w[9], w[10], w[4], pars.GC_10, amp[6]);
-  VVV1_0(w[9], w[11], w[3], pars.GC_10, amp[7]);
-  VVV1_0(w[9], w[1], w[8], pars.GC_10, amp[8]);
-  VVVV1_0(w[1], w[3], w[4], w[9], pars.GC_12, amp[9]);
-  VVVV3_0(w[1], w[3], w[4], w[9], pars.GC_12, amp[10]);
-  VVVV4_0(w[1], w[3], w[4], w[9], pars.GC_12, amp[11]);
-  VVV1_0(w[12], w[13], w[4], pars.GC_10, amp[12]);
-  VVV1_0(w[12], w[11], w[2], pars.GC_10, amp[13]);
-  VVV1_0(w[12], w[1], w[7], pars.GC_10, amp[14]);
-  VVVV1_0(w[1], w[2], w[4], w[12], pars.GC_12, amp[15]);
-  VVVV3_0(w[1], w[2], w[4], w[12], pars.GC_12, amp[16]);
-  VVVV4_0(w[1], w[2], w[4], w[12], pars.GC_12, amp[17]);
-  VVV1_0(w[14], w[13], w[3], pars.GC_10, amp[18]);
-  VVV1_0(w[14], w[10], w[2], pars.GC_10, amp[19]);
-  VVV1_0(w[14], w[1], w[6], pars.GC_10, amp[20]);
-  VVVV1_0(w[1], w[2], w[3], w[14], pars.GC_12, amp[21]);
-  VVVV3_0(w[1], w[2], w[3], w[14], pars.GC_12, amp[22]);
-  VVVV4_0(w[1], w[2], w[3], w[14], pars.GC_12, amp[23]);
-  VVV1_0(w[0], w[13], w[8], pars.GC_10, amp[24]);
-  VVV1_0(w[0], w[10], w[7], pars.GC_10, amp[25]);
-  VVV1_0(w[0], w[11], w[6], pars.GC_10, amp[26]);
-  VVV1_0(w[3], w[4], w[15], pars.GC_10, amp[27]);
-  VVV1_0(w[3], w[4], w[16], pars.GC_10, amp[28]);
-  VVV1_0(w[3], w[4], w[17], pars.GC_10, amp[29]);
-  VVV1_0(w[2], w[4], w[18], pars.GC_10, amp[30]);
-  VVV1_0(w[2], w[4], w[19], pars.GC_10, amp[31]);
-  VVV1_0(w[2], w[4], w[20], pars.GC_10, amp[32]);
-  VVV1_0(w[2], w[3], w[21], pars.GC_10, amp[33]);
-  VVV1_0(w[2], w[3], w[22], pars.GC_10, amp[34]);
-  VVV1_0(w[2], w[3], w[23], pars.GC_10, amp[35]);
-  VVV1_0(w[1], w[4], w[24], pars.GC_10, amp[36]);
-  VVV1_0(w[1], w[4], w[25], pars.GC_10, amp[37]);
-  VVV1_0(w[1], w[4], w[26], pars.GC_10, amp[38]);
-  VVV1_0(w[1], w[3], w[27], pars.GC_10, amp[39]);
-  VVV1_0(w[1], w[3], w[28], pars.GC_10, amp[40]);
-  VVV1_0(w[1], w[3], w[29], pars.GC_10, amp[41]);
-  VVV1_0(w[1], w[2], w[30], pars.GC_10, amp[42]);
-  VVV1_0(w[1], w[2], w[31], pars.GC_10, amp[43]);
-  VVV1_0(w[1], w[2], w[32], pars.GC_10, amp[44]);
+  VVV1_0(w[5], w[6], w[4], GC_10, amp[0]);
+  VVV1_0(w[5], w[7], w[3], GC_10, amp[1]);
+  VVV1_0(w[5], w[2], w[8], GC_10, amp[2]);
+  VVVV134_0(w[2], w[3], w[4], w[5], GC_12, amp[3], amp[4], amp[5]);
+  VVV1_0(w[9], w[10], w[4], GC_10, amp[6]);
+  VVV1_0(w[9], w[11], w[3], GC_10, amp[7]);
+  VVV1_0(w[9], w[1], w[8], GC_10, amp[8]);
+  VVVV134_0(w[1], w[3], w[4], w[9], GC_12, amp[9], amp[10], amp[11]);
+  VVV1_0(w[12], w[13], w[4], GC_10, amp[12]);
+  VVV1_0(w[12], w[11], w[2], GC_10, amp[13]);
+  VVV1_0(w[12], w[1], w[7], GC_10, amp[14]);
+  VVVV134_0(w[1], w[2], w[4], w[12], GC_12, amp[15], amp[16], amp[17]);
+  VVV1_0(w[14], w[13], w[3], GC_10, amp[18]);
+  VVV1_0(w[14], w[10], w[2], GC_10, amp[19]);
+  VVV1_0(w[14], w[1], w[6], GC_10, amp[20]);
+  VVVV134_0(w[1], w[2], w[3], w[14], GC_12, amp[21], amp[22], amp[23]);
+  VVV1_0(w[0], w[13], w[8], GC_10, amp[24]);
+  VVV1_0(w[0], w[10], w[7], GC_10, amp[25]);
+  VVV1_0(w[0], w[11], w[6], GC_10, amp[26]);
+  VVV1_0(w[3], w[4], w[15], GC_10, amp[27]);
+  VVV1_0(w[3], w[4], w[16], GC_10, amp[28]);
+  VVV1_0(w[3], w[4], w[17], GC_10, amp[29]);
+  VVV1_0(w[2], w[4], w[18], GC_10, amp[30]);
+  VVV1_0(w[2], w[4], w[19], GC_10, amp[31]);
+  VVV1_0(w[2], w[4], w[20], GC_10, amp[32]);
+  VVV1_0(w[2], w[3], w[21], GC_10, amp[33]);
+  VVV1_0(w[2], w[3], w[22], GC_10, amp[34]);
+  VVV1_0(w[2], w[3], w[23], GC_10, amp[35]);
+  VVV1_0(w[1], w[4], w[24], GC_10, amp[36]);
+  VVV1_0(w[1], w[4], w[25], GC_10, amp[37]);
+  VVV1_0(w[1], w[4], w[26], GC_10, amp[38]);
+  VVV1_0(w[1], w[3], w[27], GC_10, amp[39]);
+  VVV1_0(w[1], w[3], w[28], GC_10, amp[40]);
+  VVV1_0(w[1], w[3], w[29], GC_10, amp[41]);
+  VVV1_0(w[1], w[2], w[30], GC_10, amp[42]);
+  VVV1_0(w[1], w[2], w[31], GC_10, amp[43]);
+  VVV1_0(w[1], w[2], w[32], GC_10, amp[44]);
 }
 double AMP_MG5_gg_ggg::matrix_1_gg_ggg() {
   int i, j;
   // Local variables
   const int            ngraphs = 45;
   const int            ncolor  = 24;
-  std::complex<double> ztemp;
   std::complex<double> jamp[ncolor];
-  // The color matrix;
-  static const double denom[ncolor] = {108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
-                                       108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108};
-  static const double cf[ncolor][ncolor] = {{455, -58, -58, 14, 14, 68, -58, -4, 14, -58, 5,  -4,
+  // The color matrix; the common denominator 108 is applied once at the
+  // end instead of being kept as a 24-entry array of identical divisors
+  constexpr double kInvColorDenom = 1.0 / 108;
+  alignas(64) static const double cf[ncolor][ncolor] = {{455, -58, -58, 14, 14, 68, -58, -4, 14, -58, 5,  -4,
                                              14,  5,   68,  -4, 14, 68, -58, -4, -4, 68,  68, -40},
                                             {-58, 455, 14, 68, -58, 14,  -4, -58, 5,  -4, 14, -58,
                                              -58, -4,  -4, 68, 68,  -40, 14, 5,   68, -4, 14, 68},
@@ -354,210 +328,81 @@ double AMP_MG5_gg_ggg::matrix_1_gg_ggg() {
                                             {-40, 68, 68,  -4, -4, -58, 68, 14, -4, 68,  5,   14,
                                              -4,  5,  -58, 14, -4, -58, 68, 14, 14, -58, -58, 455}};
 
-  // Calculate color flows
-  jamp[0]  = +2. * (+std::complex<double>(0, 1) * amp[0] + std::complex<double>(0, 1) * amp[2] +
-                   std::complex<double>(0, 1) * amp[3] - std::complex<double>(0, 1) * amp[5] -
-                   std::complex<double>(0, 1) * amp[18] - std::complex<double>(0, 1) * amp[20] -
-                   std::complex<double>(0, 1) * amp[21] + std::complex<double>(0, 1) * amp[23] +
-                   std::complex<double>(0, 1) * amp[24] - std::complex<double>(0, 1) * amp[29] +
-                   std::complex<double>(0, 1) * amp[27] + std::complex<double>(0, 1) * amp[35] +
-                   std::complex<double>(0, 1) * amp[34] - std::complex<double>(0, 1) * amp[43] -
-                   std::complex<double>(0, 1) * amp[42]);
-  jamp[1]  = +2. * (+std::complex<double>(0, 1) * amp[1] - std::complex<double>(0, 1) * amp[2] +
-                   std::complex<double>(0, 1) * amp[4] + std::complex<double>(0, 1) * amp[5] -
-                   std::complex<double>(0, 1) * amp[12] - std::complex<double>(0, 1) * amp[14] -
-                   std::complex<double>(0, 1) * amp[15] + std::complex<double>(0, 1) * amp[17] -
-                   std::complex<double>(0, 1) * amp[24] + std::complex<double>(0, 1) * amp[29] -
-                   std::complex<double>(0, 1) * amp[27] + std::complex<double>(0, 1) * amp[32] +
-                   std::complex<double>(0, 1) * amp[31] - std::complex<double>(0, 1) * amp[44] +
-                   std::complex<double>(0, 1) * amp[42]);
-  jamp[2]  = +2. * (-std::complex<double>(0, 1) * amp[0] - std::complex<double>(0, 1) * amp[1] -
-                   std::complex<double>(0, 1) * amp[4] - std::complex<double>(0, 1) * amp[3] -
-                   std::complex<double>(0, 1) * amp[19] + std::complex<double>(0, 1) * amp[20] -
-                   std::complex<double>(0, 1) * amp[22] - std::complex<double>(0, 1) * amp[23] +
-                   std::complex<double>(0, 1) * amp[25] - std::complex<double>(0, 1) * amp[32] +
-                   std::complex<double>(0, 1) * amp[30] - std::complex<double>(0, 1) * amp[35] -
-                   std::complex<double>(0, 1) * amp[34] - std::complex<double>(0, 1) * amp[40] -
-                   std::complex<double>(0, 1) * amp[39]);
-  jamp[3]  = +2. * (+std::complex<double>(0, 1) * amp[1] - std::complex<double>(0, 1) * amp[2] +
-                   std::complex<double>(0, 1) * amp[4] + std::complex<double>(0, 1) * amp[5] -
-                   std::complex<double>(0, 1) * amp[6] - std::complex<double>(0, 1) * amp[8] -
-                   std::complex<double>(0, 1) * amp[9] + std::complex<double>(0, 1) * amp[11] -
-                   std::complex<double>(0, 1) * amp[25] + std::complex<double>(0, 1) * amp[29] +
-                   std::complex<double>(0, 1) * amp[28] + std::complex<double>(0, 1) * amp[32] -
-                   std::complex<double>(0, 1) * amp[30] - std::complex<double>(0, 1) * amp[41] +
-                   std::complex<double>(0, 1) * amp[39]);
-  jamp[4]  = +2. * (-std::complex<double>(0, 1) * amp[0] - std::complex<double>(0, 1) * amp[1] -
-                   std::complex<double>(0, 1) * amp[4] - std::complex<double>(0, 1) * amp[3] -
-                   std::complex<double>(0, 1) * amp[13] + std::complex<double>(0, 1) * amp[14] -
-                   std::complex<double>(0, 1) * amp[16] - std::complex<double>(0, 1) * amp[17] +
-                   std::complex<double>(0, 1) * amp[26] - std::complex<double>(0, 1) * amp[32] -
-                   std::complex<double>(0, 1) * amp[31] - std::complex<double>(0, 1) * amp[35] +
-                   std::complex<double>(0, 1) * amp[33] - std::complex<double>(0, 1) * amp[37] -
-                   std::complex<double>(0, 1) * amp[36]);
-  jamp[5]  = +2. * (+std::complex<double>(0, 1) * amp[0] + std::complex<double>(0, 1) * amp[2] +
-                   std::complex<double>(0, 1) * amp[3] - std::complex<double>(0, 1) * amp[5] -
-                   std::complex<double>(0, 1) * amp[7] + std::complex<double>(0, 1) * amp[8] -
-                   std::complex<double>(0, 1) * amp[10] - std::complex<double>(0, 1) * amp[11] -
-                   std::complex<double>(0, 1) * amp[26] - std::complex<double>(0, 1) * amp[29] -
-                   std::complex<double>(0, 1) * amp[28] + std::complex<double>(0, 1) * amp[35] -
-                   std::complex<double>(0, 1) * amp[33] - std::complex<double>(0, 1) * amp[38] +
-                   std::complex<double>(0, 1) * amp[36]);
-  jamp[6]  = +2. * (+std::complex<double>(0, 1) * amp[6] + std::complex<double>(0, 1) * amp[8] +
-                   std::complex<double>(0, 1) * amp[9] - std::complex<double>(0, 1) * amp[11] +
-                   std::complex<double>(0, 1) * amp[18] + std::complex<double>(0, 1) * amp[19] +
-                   std::complex<double>(0, 1) * amp[22] + std::complex<double>(0, 1) * amp[21] -
-                   std::complex<double>(0, 1) * amp[24] - std::complex<double>(0, 1) * amp[28] -
-                   std::complex<double>(0, 1) * amp[27] + std::complex<double>(0, 1) * amp[41] +
-                   std::complex<double>(0, 1) * amp[40] + std::complex<double>(0, 1) * amp[43] +
-                   std::complex<double>(0, 1) * amp[42]);
-  jamp[7]  = +2. * (+std::complex<double>(0, 1) * amp[7] - std::complex<double>(0, 1) * amp[8] +
-                   std::complex<double>(0, 1) * amp[10] + std::complex<double>(0, 1) * amp[11] +
-                   std::complex<double>(0, 1) * amp[12] + std::complex<double>(0, 1) * amp[13] +
-                   std::complex<double>(0, 1) * amp[16] + std::complex<double>(0, 1) * amp[15] +
-                   std::complex<double>(0, 1) * amp[24] + std::complex<double>(0, 1) * amp[28] +
-                   std::complex<double>(0, 1) * amp[27] + std::complex<double>(0, 1) * amp[38] +
-                   std::complex<double>(0, 1) * amp[37] + std::complex<double>(0, 1) * amp[44] -
-                   std::complex<double>(0, 1) * amp[42]);
-  jamp[8]  = +2. * (-std::complex<double>(0, 1) * amp[6] - std::complex<double>(0, 1) * amp[7] -
-                   std::complex<double>(0, 1) * amp[10] - std::complex<double>(0, 1) * amp[9] -
-                   std::complex<double>(0, 1) * amp[19] + std::complex<double>(0, 1) * amp[20] -
-                   std::complex<double>(0, 1) * amp[22] - std::complex<double>(0, 1) * amp[23] -
-                   std::complex<double>(0, 1) * amp[26] - std::complex<double>(0, 1) * amp[34] -
-                   std::complex<double>(0, 1) * amp[33] - std::complex<double>(0, 1) * amp[38] +
-                   std::complex<double>(0, 1) * amp[36] - std::complex<double>(0, 1) * amp[41] -
-                   std::complex<double>(0, 1) * amp[40]);
-  jamp[9]  = +2. * (-std::complex<double>(0, 1) * amp[0] - std::complex<double>(0, 1) * amp[2] -
-                   std::complex<double>(0, 1) * amp[3] + std::complex<double>(0, 1) * amp[5] +
-                   std::complex<double>(0, 1) * amp[7] - std::complex<double>(0, 1) * amp[8] +
-                   std::complex<double>(0, 1) * amp[10] + std::complex<double>(0, 1) * amp[11] +
-                   std::complex<double>(0, 1) * amp[26] + std::complex<double>(0, 1) * amp[29] +
-                   std::complex<double>(0, 1) * amp[28] - std::complex<double>(0, 1) * amp[35] +
-                   std::complex<double>(0, 1) * amp[33] + std::complex<double>(0, 1) * amp[38] -
-                   std::complex<double>(0, 1) * amp[36]);
-  jamp[10] = +2. * (-std::complex<double>(0, 1) * amp[6] - std::complex<double>(0, 1) * amp[7] -
-                    std::complex<double>(0, 1) * amp[10] - std::complex<double>(0, 1) * amp[9] -
-                    std::complex<double>(0, 1) * amp[13] + std::complex<double>(0, 1) * amp[14] -
-                    std::complex<double>(0, 1) * amp[16] - std::complex<double>(0, 1) * amp[17] -
-                    std::complex<double>(0, 1) * amp[25] - std::complex<double>(0, 1) * amp[31] -
-                    std::complex<double>(0, 1) * amp[30] - std::complex<double>(0, 1) * amp[38] -
-                    std::complex<double>(0, 1) * amp[37] - std::complex<double>(0, 1) * amp[41] +
-                    std::complex<double>(0, 1) * amp[39]);
-  jamp[11] = +2. * (-std::complex<double>(0, 1) * amp[1] + std::complex<double>(0, 1) * amp[2] -
-                    std::complex<double>(0, 1) * amp[4] - std::complex<double>(0, 1) * amp[5] +
-                    std::complex<double>(0, 1) * amp[6] + std::complex<double>(0, 1) * amp[8] +
-                    std::complex<double>(0, 1) * amp[9] - std::complex<double>(0, 1) * amp[11] +
-                    std::complex<double>(0, 1) * amp[25] - std::complex<double>(0, 1) * amp[29] -
-                    std::complex<double>(0, 1) * amp[28] - std::complex<double>(0, 1) * amp[32] +
-                    std::complex<double>(0, 1) * amp[30] + std::complex<double>(0, 1) * amp[41] -
-                    std::complex<double>(0, 1) * amp[39]);
-  jamp[12] = +2. * (+std::complex<double>(0, 1) * amp[12] + std::complex<double>(0, 1) * amp[14] +
-                    std::complex<double>(0, 1) * amp[15] - std::complex<double>(0, 1) * amp[17] +
-                    std::complex<double>(0, 1) * amp[18] + std::complex<double>(0, 1) * amp[19] +
-                    std::complex<double>(0, 1) * amp[22] + std::complex<double>(0, 1) * amp[21] -
-                    std::complex<double>(0, 1) * amp[25] - std::complex<double>(0, 1) * amp[31] -
-                    std::complex<double>(0, 1) * amp[30] + std::complex<double>(0, 1) * amp[40] +
-                    std::complex<double>(0, 1) * amp[39] + std::complex<double>(0, 1) * amp[44] +
-                    std::complex<double>(0, 1) * amp[43]);
-  jamp[13] = +2. * (+std::complex<double>(0, 1) * amp[6] + std::complex<double>(0, 1) * amp[7] +
-                    std::complex<double>(0, 1) * amp[10] + std::complex<double>(0, 1) * amp[9] +
-                    std::complex<double>(0, 1) * amp[13] - std::complex<double>(0, 1) * amp[14] +
-                    std::complex<double>(0, 1) * amp[16] + std::complex<double>(0, 1) * amp[17] +
-                    std::complex<double>(0, 1) * amp[25] + std::complex<double>(0, 1) * amp[31] +
-                    std::complex<double>(0, 1) * amp[30] + std::complex<double>(0, 1) * amp[38] +
-                    std::complex<double>(0, 1) * amp[37] + std::complex<double>(0, 1) * amp[41] -
-                    std::complex<double>(0, 1) * amp[39]);
-  jamp[14] = +2. * (-std::complex<double>(0, 1) * amp[12] - std::complex<double>(0, 1) * amp[13] -
-                    std::complex<double>(0, 1) * amp[16] - std::complex<double>(0, 1) * amp[15] -
-                    std::complex<double>(0, 1) * amp[18] - std::complex<double>(0, 1) * amp[20] -
-                    std::complex<double>(0, 1) * amp[21] + std::complex<double>(0, 1) * amp[23] +
-                    std::complex<double>(0, 1) * amp[26] + std::complex<double>(0, 1) * amp[34] +
-                    std::complex<double>(0, 1) * amp[33] - std::complex<double>(0, 1) * amp[37] -
-                    std::complex<double>(0, 1) * amp[36] - std::complex<double>(0, 1) * amp[44] -
-                    std::complex<double>(0, 1) * amp[43]);
-  jamp[15] = +2. * (+std::complex<double>(0, 1) * amp[0] + std::complex<double>(0, 1) * amp[1] +
-                    std::complex<double>(0, 1) * amp[4] + std::complex<double>(0, 1) * amp[3] +
-                    std::complex<double>(0, 1) * amp[13] - std::complex<double>(0, 1) * amp[14] +
-                    std::complex<double>(0, 1) * amp[16] + std::complex<double>(0, 1) * amp[17] -
-                    std::complex<double>(0, 1) * amp[26] + std::complex<double>(0, 1) * amp[32] +
-                    std::complex<double>(0, 1) * amp[31] + std::complex<double>(0, 1) * amp[35] -
-                    std::complex<double>(0, 1) * amp[33] + std::complex<double>(0, 1) * amp[37] +
-                    std::complex<double>(0, 1) * amp[36]);
-  jamp[16] = +2. * (-std::complex<double>(0, 1) * amp[7] + std::complex<double>(0, 1) * amp[8] -
-                    std::complex<double>(0, 1) * amp[10] - std::complex<double>(0, 1) * amp[11] -
-                    std::complex<double>(0, 1) * amp[12] - std::complex<double>(0, 1) * amp[13] -
-                    std::complex<double>(0, 1) * amp[16] - std::complex<double>(0, 1) * amp[15] -
-                    std::complex<double>(0, 1) * amp[24] - std::complex<double>(0, 1) * amp[28] -
-                    std::complex<double>(0, 1) * amp[27] - std::complex<double>(0, 1) * amp[38] -
-                    std::complex<double>(0, 1) * amp[37] - std::complex<double>(0, 1) * amp[44] +
-                    std::complex<double>(0, 1) * amp[42]);
-  jamp[17] = +2. * (-std::complex<double>(0, 1) * amp[1] + std::complex<double>(0, 1) * amp[2] -
-                    std::complex<double>(0, 1) * amp[4] - std::complex<double>(0, 1) * amp[5] +
-                    std::complex<double>(0, 1) * amp[12] + std::complex<double>(0, 1) * amp[14] +
-                    std::complex<double>(0, 1) * amp[15] - std::complex<double>(0, 1) * amp[17] +
-                    std::complex<double>(0, 1) * amp[24] - std::complex<double>(0, 1) * amp[29] +
-                    std::complex<double>(0, 1) * amp[27] - std::complex<double>(0, 1) * amp[32] -
-                    std::complex<double>(0, 1) * amp[31] + std::complex<double>(0, 1) * amp[44] -
-                    std::complex<double>(0, 1) * amp[42]);
-  jamp[18] = +2. * (+std::complex<double>(0, 1) * amp[12] + std::complex<double>(0, 1) * amp[13] +
-                    std::complex<double>(0, 1) * amp[16] + std::complex<double>(0, 1) * amp[15] +
-                    std::complex<double>(0, 1) * amp[18] + std::complex<double>(0, 1) * amp[20] +
-                    std::complex<double>(0, 1) * amp[21] - std::complex<double>(0, 1) * amp[23] -
-                    std::complex<double>(0, 1) * amp[26] - std::complex<double>(0, 1) * amp[34] -
-                    std::complex<double>(0, 1) * amp[33] + std::complex<double>(0, 1) * amp[37] +
-                    std::complex<double>(0, 1) * amp[36] + std::complex<double>(0, 1) * amp[44] +
-                    std::complex<double>(0, 1) * amp[43]);
-  jamp[19] = +2. * (+std::complex<double>(0, 1) * amp[6] + std::complex<double>(0, 1) * amp[7] +
-                    std::complex<double>(0, 1) * amp[10] + std::complex<double>(0, 1) * amp[9] +
-                    std::complex<double>(0, 1) * amp[19] - std::complex<double>(0, 1) * amp[20] +
-                    std::complex<double>(0, 1) * amp[22] + std::complex<double>(0, 1) * amp[23] +
-                    std::complex<double>(0, 1) * amp[26] + std::complex<double>(0, 1) * amp[34] +
-                    std::complex<double>(0, 1) * amp[33] + std::complex<double>(0, 1) * amp[38] -
-                    std::complex<double>(0, 1) * amp[36] + std::complex<double>(0, 1) * amp[41] +
-                    std::complex<double>(0, 1) * amp[40]);
-  jamp[20] = +2. * (-std::complex<double>(0, 1) * amp[12] - std::complex<double>(0, 1) * amp[14] -
-                    std::complex<double>(0, 1) * amp[15] + std::complex<double>(0, 1) * amp[17] -
-                    std::complex<double>(0, 1) * amp[18] - std::complex<double>(0, 1) * amp[19] -
-                    std::complex<double>(0, 1) * amp[22] - std::complex<double>(0, 1) * amp[21] +
-                    std::complex<double>(0, 1) * amp[25] + std::complex<double>(0, 1) * amp[31] +
-                    std::complex<double>(0, 1) * amp[30] - std::complex<double>(0, 1) * amp[40] -
-                    std::complex<double>(0, 1) * amp[39] - std::complex<double>(0, 1) * amp[44] -
-                    std::complex<double>(0, 1) * amp[43]);
-  jamp[21] = +2. * (+std::complex<double>(0, 1) * amp[0] + std::complex<double>(0, 1) * amp[1] +
-                    std::complex<double>(0, 1) * amp[4] + std::complex<double>(0, 1) * amp[3] +
-                    std::complex<double>(0, 1) * amp[19] - std::complex<double>(0, 1) * amp[20] +
-                    std::complex<double>(0, 1) * amp[22] + std::complex<double>(0, 1) * amp[23] -
-                    std::complex<double>(0, 1) * amp[25] + std::complex<double>(0, 1) * amp[32] -
-                    std::complex<double>(0, 1) * amp[30] + std::complex<double>(0, 1) * amp[35] +
-                    std::complex<double>(0, 1) * amp[34] + std::complex<double>(0, 1) * amp[40] +
-                    std::complex<double>(0, 1) * amp[39]);
-  jamp[22] = +2. * (-std::complex<double>(0, 1) * amp[6] - std::complex<double>(0, 1) * amp[8] -
-                    std::complex<double>(0, 1) * amp[9] + std::complex<double>(0, 1) * amp[11] -
-                    std::complex<double>(0, 1) * amp[18] - std::complex<double>(0, 1) * amp[19] -
-                    std::complex<double>(0, 1) * amp[22] - std::complex<double>(0, 1) * amp[21] +
-                    std::complex<double>(0, 1) * amp[24] + std::complex<double>(0, 1) * amp[28] +
-                    std::complex<double>(0, 1) * amp[27] - std::complex<double>(0, 1) * amp[41] -
-                    std::complex<double>(0, 1) * amp[40] - std::complex<double>(0, 1) * amp[43] -
-                    std::complex<double>(0, 1) * amp[42]);
-  jamp[23] = +2. * (-std::complex<double>(0, 1) * amp[0] - std::complex<double>(0, 1) * amp[2] -
-                    std::complex<double>(0, 1) * amp[3] + std::complex<double>(0, 1) * amp[5] +
-                    std::complex<double>(0, 1) * amp[18] + std::complex<double>(0, 1) * amp[20] +
-                    std::complex<double>(0, 1) * amp[21] - std::complex<double>(0, 1) * amp[23] -
-                    std::complex<double>(0, 1) * amp[24] + std::complex<double>(0, 1) * amp[29] -
-                    std::complex<double>(0, 1) * amp[27] - std::complex<double>(0, 1) * amp[35] -
-                    std::complex<double>(0, 1) * amp[34] + std::complex<double>(0, 1) * amp[43] +
-                    std::complex<double>(0, 1) * amp[42]);
-
-  // Sum and square the color flows to get the matrix element
-  double matrix = 0;
+  // Calculate color flows: jamp[i] = 2i * sum_k sign * amp[k]. The per-flow
+  // terms are tabulated as 1-based signed amplitude indices instead of 24
+  // unrolled 15-term expressions, so the sum is a compact data-driven loop
+  static const int nflowterms = 15;
+  alignas(64) static const int colorflow[ncolor][nflowterms] = {
+      {+1, +3, +4, -6, -19, -21, -22, +24, +25, -30, +28, +36, +35, -44, -43},
+      {+2, -3, +5, +6, -13, -15, -16, +18, -25, +30, -28, +33, +32, -45, +43},
+      {-1, -2, -5, -4, -20, +21, -23, -24, +26, -33, +31, -36, -35, -41, -40},
+      {+2, -3, +5, +6, -7, -9, -10, +12, -26, +30, +29, +33, -31, -42, +40},
+      {-1, -2, -5, -4, -14, +15, -17, -18, +27, -33, -32, -36, +34, -38, -37},
+      {+1, +3, +4, -6, -8, +9, -11, -12, -27, -30, -29, +36, -34, -39, +37},
+      {+7, +9, +10, -12, +19, +20, +23, +22, -25, -29, -28, +42, +41, +44, +43},
+      {+8, -9, +11, +12, +13, +14, +17, +16, +25, +29, +28, +39, +38, +45, -43},
+      {-7, -8, -11, -10, -20, +21, -23, -24, -27, -35, -34, -39, +37, -42, -41},
+      {-1, -3, -4, +6, +8, -9, +11, +12, +27, +30, +29, -36, +34, +39, -37},
+      {-7, -8, -11, -10, -14, +15, -17, -18, -26, -32, -31, -39, -38, -42, +40},
+      {-2, +3, -5, -6, +7, +9, +10, -12, +26, -30, -29, -33, +31, +42, -40},
+      {+13, +15, +16, -18, +19, +20, +23, +22, -26, -32, -31, +41, +40, +45, +44},
+      {+7, +8, +11, +10, +14, -15, +17, +18, +26, +32, +31, +39, +38, +42, -40},
+      {-13, -14, -17, -16, -19, -21, -22, +24, +27, +35, +34, -38, -37, -45, -44},
+      {+1, +2, +5, +4, +14, -15, +17, +18, -27, +33, +32, +36, -34, +38, +37},
+      {-8, +9, -11, -12, -13, -14, -17, -16, -25, -29, -28, -39, -38, -45, +43},
+      {-2, +3, -5, -6, +13, +15, +16, -18, +25, -30, +28, -33, -32, +45, -43},
+      {+13, +14, +17, +16, +19, +21, +22, -24, -27, -35, -34, +38, +37, +45, +44},
+      {+7, +8, +11, +10, +20, -21, +23, +24, +27, +35, +34, +39, -37, +42, +41},
+      {-13, -15, -16, +18, -19, -20, -23, -22, +26, +32, +31, -41, -40, -45, -44},
+      {+1, +2, +5, +4, +20, -21, +23, +24, -26, +33, -31, +36, +35, +41, +40},
+      {-7, -9, -10, +12, -19, -20, -23, -22, +25, +29, +28, -42, -41, -44, -43},
+      {-1, -3, -4, +6, +19, +21, +22, -24, -25, +30, -28, -36, -35, +44, +43}};
+
   for (i = 0; i < ncolor; i++) {
-    ztemp = 0.;
-    for (j = 0; j < ncolor; j++) ztemp = ztemp + cf[i][j] * jamp[j];
-    matrix = matrix + real(ztemp * conj(jamp[i])) / denom[i];
+    std::complex<double> sum = 0.0;
+    for (j = 0; j < nflowterms; j++) {
+      const int idx = colorflow[i][j];
+      sum += (idx > 0) ? amp[idx - 1] : -amp[-idx - 1];
+    }
+    // Multiplication by 2i written as component swap/negate, avoiding a
+    // full complex product against a constant
+    jamp[i] = std::complex<double>(-2. * imag(sum), 2. * real(sum));
+
+    // Store the leading color flows for choice of color, accumulated here
+    // in the same pass instead of a separate trailing loop
+    jamp2[0][i] += real(jamp[i] * conj(jamp[i]));
   }
 
-  // Store the leading color flows for choice of color
-  for (i = 0; i < ncolor; i++) jamp2[0][i] += real(jamp[i] * conj(jamp[i]));
+  // The color matrix is symmetric positive definite, so the quadratic form
+  // jamp^H cf jamp is evaluated through the Cholesky factor cf = L L^T as
+  // |L^T jamp|^2: half the multiplies of the full double loop and no
+  // conjugate products. L is computed once on first use.
+  static const auto L = [] {
+    std::array<std::array<double, ncolor>, ncolor> out{};
+    for (int a = 0; a < ncolor; a++) {
+      for (int b = 0; b <= a; b++) {
+        double s = cf[a][b];
+        for (int c = 0; c < b; c++) { s -= out[a][c] * out[b][c]; }
+        out[a][b] = (a == b) ? std::sqrt(s) : s / out[b][b];
+      }
+    }
+    return out;
+  }();
+
+  // Sum and square the color flows to get the matrix element. The
+  // triangular sweep uses split re/im accumulators, so it is plain real
+  // arithmetic over contiguous data which the compiler can vectorize
+  double matrix = 0;
+  for (i = 0; i < ncolor; i++) {
+    double vre = 0.0;
+    double vim = 0.0;
+    for (j = i; j < ncolor; j++) {
+      vre += L[j][i] * real(jamp[j]);
+      vim += L[j][i] * imag(jamp[j]);
+    }
+    matrix = matrix + (vre * vre + vim * vim);
+  }
+  matrix *= kInvColorDenom;
 
   return matrix;
 }
@@ -96,14 +96,8 @@ double AMP_MG5_yy_ww::CalcAmp2(gra::LORENTZSCALAR &lts, double alphas) {
   }
   // @@@@@@@@@@@@@@@@@@@@@@@@@@ GRANIITTI @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
   const int ncomb = 36;
-  lts.hamp        = std::vector<std::complex<double>>(ncomb);  // GRANIITTI
-
-  static bool            goodhel[ncomb] = {ncomb * false};
-  static int             ntry = 0, sum_hel = 0, ngood = 0;
-  static int             igood[ncomb];
-  static int             jhel;
-  std::complex<double> **wfs;
-  double                 t[nprocesses];
+  lts.hamp.assign(ncomb, 0.0);  // GRANIITTI: re-uses capacity, no per-call allocation
+
   // Helicities for the process
   static const int helicities[ncomb][nexternal] = {
       {-1, -1, -1, -1}, {-1, -1, -1, 0}, {-1, -1, -1, 1}, {-1, -1, 0, -1}, {-1, -1, 0, 0},
@@ -115,9 +109,7 @@ double AMP_MG5_yy_ww::CalcAmp2(gra::LORENTZSCALAR &lts, double alphas) {
       {1, 1, 0, -1},    {1, 1, 0, 0},    {1, 1, 0, 1},    {1, 1, 1, -1},   {1, 1, 1, 0},
       {1, 1, 1, 1}};
   // Denominators: spins, colors and identical particles
-  const int denominators[nprocesses] = {4};
-
-  ntry = 1;  // GRANIITTI
+  constexpr double kInvDenom = 1.0 / 4;
 
   // Reset the matrix elements
   for (int i = 0; i < nprocesses; i++) { matrix_element[i] = 0.; }
@@ -125,50 +117,7 @@ double AMP_MG5_yy_ww::CalcAmp2(gra::LORENTZSCALAR &lts, double alphas) {
   int perm[nexternal];
   for (int i = 0; i < nexternal; i++) { perm[i] = i; }
 
-  goto SKIPLABEL;  // GRANIITTI: Skip this block
-  if (sum_hel == 0 || ntry < 10) {
-    // Calculate the matrix element for all helicities
-    for (int ihel = 0; ihel < ncomb; ihel++) {
-      if (goodhel[ihel] || ntry < 2) {
-        calculate_wavefunctions(perm, helicities[ihel]);
-        t[0] = matrix_1_aa_wpwm();
-
-        double tsum = 0;
-        for (int iproc = 0; iproc < nprocesses; iproc++) {
-          matrix_element[iproc] += t[iproc];
-          tsum += t[iproc];
-        }
-        // Store which helicities give non-zero result
-        if (tsum != 0. && !goodhel[ihel]) {
-          goodhel[ihel] = true;
-          ngood++;
-          igood[ngood] = ihel;
-        }
-      }
-    }
-    jhel    = 0;
-    sum_hel = min(sum_hel, ngood);
-  } else {
-    // Only use the "good" helicities
-    for (int j = 0; j < sum_hel; j++) {
-      jhel++;
-      if (jhel >= ngood) jhel = 0;
-      double hwgt = double(ngood) / double(sum_hel);
-      int    ihel = igood[jhel];
-      calculate_wavefunctions(perm, helicities[ihel]);
-      t[0] = matrix_1_aa_wpwm();
-
-      for (int iproc = 0; iproc < nprocesses; iproc++) { matrix_element[iproc] += t[iproc] * hwgt; }
-    }
-  }
-
-  for (int i = 0; i < nprocesses; i++) matrix_element[i] /= denominators[i];
-
-SKIPLABEL:
 
-  // @@@@@@@@@@@@@@@@@@@@@@@@@@ GRANIITTI @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
-  // Define permutation
-  for (int i = 0; i < nexternal; ++i) { perm[i] = i; }
 
   // Loop over helicity combinations
   for (int ihel = 0; ihel < ncomb; ++ihel) {
@@ -181,7 +130,7 @@ SKIPLABEL:
   // Total amplitude squared over all helicity combinations individually
   double amp2 = 0.0;
   for (int ihel = 0; ihel < ncomb; ++ihel) { amp2 += gra::math::abs2(lts.hamp[ihel]); }
-  amp2 /= denominators[0];  // spin average matrix element squared
+  amp2 *= kInvDenom;  // spin average matrix element squared
 
   return amp2;  // amplitude squared
                 // @@@@@@@@@@@@@@@@@@@@@@@@@@ GRANIITTI @@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
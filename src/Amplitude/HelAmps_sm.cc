@@ -1105,14 +1105,16 @@ void VVV1P0_1(std::complex<double> V2[], std::complex<double> V3[], std::complex
   TMP8  = (P3[0] * V2[2] - P3[1] * V2[3] - P3[2] * V2[4] - P3[3] * V2[5]);
   denom = COUP / ((P1[0] * P1[0]) - (P1[1] * P1[1]) - (P1[2] * P1[2]) - (P1[3] * P1[3]) -
                   M1 * (M1 - cI * W1));
-  V1[2] = denom * (TMP9 * (-cI * (P2[0]) + cI * (P3[0])) +
-                   (V2[2] * (-cI * (TMP4) + cI * (TMP5)) + V3[2] * (-cI * (TMP8) + cI * (TMP6))));
-  V1[3] = denom * (TMP9 * (-cI * (P2[1]) + cI * (P3[1])) +
-                   (V2[3] * (-cI * (TMP4) + cI * (TMP5)) + V3[3] * (-cI * (TMP8) + cI * (TMP6))));
-  V1[4] = denom * (TMP9 * (-cI * (P2[2]) + cI * (P3[2])) +
-                   (V2[4] * (-cI * (TMP4) + cI * (TMP5)) + V3[4] * (-cI * (TMP8) + cI * (TMP6))));
-  V1[5] = denom * (TMP9 * (-cI * (P2[3]) + cI * (P3[3])) +
-                   (V2[5] * (-cI * (TMP4) + cI * (TMP5)) + V3[5] * (-cI * (TMP8) + cI * (TMP6))));
+  // The V2 and V3 coefficients and the momentum-difference prefactor are
+  // identical for all four components; hoist them so each component is left
+  // with three multiplies instead of re-deriving the shared factors
+  const std::complex<double> FA = cI * (TMP5 - TMP4);
+  const std::complex<double> FB = cI * (TMP6 - TMP8);
+  const std::complex<double> F9 = cI * TMP9;
+  V1[2] = denom * (F9 * (P3[0] - P2[0]) + V2[2] * FA + V3[2] * FB);
+  V1[3] = denom * (F9 * (P3[1] - P2[1]) + V2[3] * FA + V3[3] * FB);
+  V1[4] = denom * (F9 * (P3[2] - P2[2]) + V2[4] * FA + V3[4] * FB);
+  V1[5] = denom * (F9 * (P3[3] - P2[3]) + V2[5] * FA + V3[5] * FB);
 }
 
 
@@ -1276,4 +1278,65 @@ void VVVV1_0(std::complex<double> V1[], std::complex<double> V2[], std::complex<
 }
 
 
+void VVVV134P0_1(std::complex<double> V2[], std::complex<double> V3[], std::complex<double> V4[],
+                 std::complex<double> COUP, double M1, double W1, std::complex<double> V1A[],
+                 std::complex<double> V1B[], std::complex<double> V1C[]) {
+  static std::complex<double> cI = std::complex<double>(0., 1.);
+  std::complex<double>        TMP0;
+  std::complex<double>        TMP2;
+  std::complex<double>        TMP9;
+  double                      P1[4];
+  std::complex<double>        denom;
+  V1A[0] = +V2[0] + V3[0] + V4[0];
+  V1A[1] = +V2[1] + V3[1] + V4[1];
+  V1B[0] = V1A[0];
+  V1B[1] = V1A[1];
+  V1C[0] = V1A[0];
+  V1C[1] = V1A[1];
+  P1[0]  = -V1A[0].real();
+  P1[1]  = -V1A[1].real();
+  P1[2]  = -V1A[1].imag();
+  P1[3]  = -V1A[0].imag();
+  TMP0   = (V4[2] * V2[2] - V4[3] * V2[3] - V4[4] * V2[4] - V4[5] * V2[5]);
+  TMP2   = (V4[2] * V3[2] - V4[3] * V3[3] - V4[4] * V3[4] - V4[5] * V3[5]);
+  TMP9   = (V2[2] * V3[2] - V2[3] * V3[3] - V2[4] * V3[4] - V2[5] * V3[5]);
+  denom  = COUP / ((P1[0] * P1[0]) - (P1[1] * P1[1]) - (P1[2] * P1[2]) - (P1[3] * P1[3]) -
+                  M1 * (M1 - cI * W1));
+  V1A[2] = denom * (-cI * (V4[2] * TMP9) + cI * (V3[2] * TMP0));
+  V1A[3] = denom * (-cI * (V4[3] * TMP9) + cI * (V3[3] * TMP0));
+  V1A[4] = denom * (-cI * (V4[4] * TMP9) + cI * (V3[4] * TMP0));
+  V1A[5] = denom * (-cI * (V4[5] * TMP9) + cI * (V3[5] * TMP0));
+  V1B[2] = denom * (-cI * (V4[2] * TMP9) + cI * (V2[2] * TMP2));
+  V1B[3] = denom * (-cI * (V4[3] * TMP9) + cI * (V2[3] * TMP2));
+  V1B[4] = denom * (-cI * (V4[4] * TMP9) + cI * (V2[4] * TMP2));
+  V1B[5] = denom * (-cI * (V4[5] * TMP9) + cI * (V2[5] * TMP2));
+  V1C[2] = denom * (-cI * (V3[2] * TMP0) + cI * (V2[2] * TMP2));
+  V1C[3] = denom * (-cI * (V3[3] * TMP0) + cI * (V2[3] * TMP2));
+  V1C[4] = denom * (-cI * (V3[4] * TMP0) + cI * (V2[4] * TMP2));
+  V1C[5] = denom * (-cI * (V3[5] * TMP0) + cI * (V2[5] * TMP2));
+}
+
+
+void VVVV134_0(std::complex<double> V1[], std::complex<double> V2[], std::complex<double> V3[],
+               std::complex<double> V4[], std::complex<double> COUP, std::complex<double>& vertex1,
+               std::complex<double>& vertex3, std::complex<double>& vertex4) {
+  static std::complex<double> cI = std::complex<double>(0., 1.);
+  std::complex<double>        TMP0;
+  std::complex<double>        TMP1;
+  std::complex<double>        TMP2;
+  std::complex<double>        TMP3;
+  std::complex<double>        TMP9;
+  std::complex<double>        TMP11;
+  TMP0    = (V4[2] * V2[2] - V4[3] * V2[3] - V4[4] * V2[4] - V4[5] * V2[5]);
+  TMP1    = (V3[2] * V1[2] - V3[3] * V1[3] - V3[4] * V1[4] - V3[5] * V1[5]);
+  TMP2    = (V4[2] * V3[2] - V4[3] * V3[3] - V4[4] * V3[4] - V4[5] * V3[5]);
+  TMP3    = (V2[2] * V1[2] - V2[3] * V1[3] - V2[4] * V1[4] - V2[5] * V1[5]);
+  TMP9    = (V2[2] * V3[2] - V2[3] * V3[3] - V2[4] * V3[4] - V2[5] * V3[5]);
+  TMP11   = (V4[2] * V1[2] - V4[3] * V1[3] - V4[4] * V1[4] - V4[5] * V1[5]);
+  vertex1 = COUP * (-cI * (TMP9 * TMP11) + cI * (TMP0 * TMP1));
+  vertex3 = COUP * (-cI * (TMP9 * TMP11) + cI * (TMP2 * TMP3));
+  vertex4 = COUP * (-cI * (TMP0 * TMP1) + cI * (TMP2 * TMP3));
+}
+
+
 }  // namespace MG5_sm
@@ -4,12 +4,15 @@
 // Licensed under the MIT License <http://opensource.org/licenses/MIT>.
 
 // C++
+#include <cctype>
 #include <chrono>
 #include <complex>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
-#include <regex>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <vector>
 
@@ -17,7 +20,9 @@
 
 // C system functions
 #include <fcntl.h>
+#include <spawn.h>
 #include <sys/resource.h>
+#include <sys/wait.h>
 #include <sys/stat.h>
 #include <sys/statvfs.h>
 #include <sys/time.h>
@@ -49,38 +54,61 @@
 namespace gra {
 namespace aux {
 
+// Check do we have terminal output (=true), or output to file (=false)
+static const bool IS_TERMINAL = isatty(fileno(stdout)) != 0;
+
+// Pre-rendered ANSI escapes for the hot printers; streaming the rang
+// manipulators re-evaluates terminal support on every call
+static constexpr char ANSI_GREEN[]       = "\x1b[32m";
+static constexpr char ANSI_RED[]         = "\x1b[31m";
+static constexpr char ANSI_FG_RESET[]    = "\x1b[39m";
+static constexpr char ANSI_BOLD[]        = "\x1b[1m";
+static constexpr char ANSI_STYLE_RESET[] = "\x1b[0m";
+
 // -------------------------------------------------------
 // FIXED HERE manually
 
-double      GetVersion()     { return 1.090; }
-std::string GetVersionType() { return "pre-release"; }
-std::string GetVersionDate() { return "06.06.2023"; }
-std::string GetVersionUpdate() {
-  return "Update installation scripts and LHAPDF to 6.5.4";
-}
+namespace {
+constexpr double      VERSION        = 1.090;
+constexpr const char *VERSION_TYPE   = "pre-release";
+constexpr const char *VERSION_DATE   = "06.06.2023";
+constexpr const char *VERSION_UPDATE = "Update installation scripts and LHAPDF to 6.5.4";
+}  // namespace
+
+double      GetVersion()       { return VERSION; }
+std::string GetVersionType()   { return VERSION_TYPE; }
+std::string GetVersionDate()   { return VERSION_DATE; }
+std::string GetVersionUpdate() { return VERSION_UPDATE; }
 
 void PrintVersion() {
-  std::cout << GetVersionString() << std::endl;
-  std::cout << rang::style::bold << "<github.com/mieskolainen/graniitti>" << rang::style::reset
-            << std::endl
-            << std::endl;
-  std::cout << "References: arXiv:1910.06300, arXiv:2304.06010 [hep-ph]" << std::endl;
-  std::cout << std::endl;
-  std::cout << "(c) 2017-2023 Mikael Mieskolainen" << std::endl;
-  std::cout << "<m.mieskolainen@imperial.ac.uk>" << std::endl;
-  std::cout << std::endl;
-  std::cout << "<opensource.org/licenses/GPL-3.0>" << std::endl;
-  std::cout << "<opensource.org/licenses/MIT>" << std::endl;
+  // Rendered once into a single buffer (with or without escape codes,
+  // fixed at startup by IS_TERMINAL) and emitted with one write
+  static const std::string BANNER = []() {
+    std::string s = GetVersionString() + "\n";
+    if (IS_TERMINAL) { s += ANSI_BOLD; }
+    s += "<github.com/mieskolainen/graniitti>";
+    if (IS_TERMINAL) { s += ANSI_STYLE_RESET; }
+    s +=
+        "\n\n"
+        "References: arXiv:1910.06300, arXiv:2304.06010 [hep-ph]\n"
+        "\n"
+        "(c) 2017-2023 Mikael Mieskolainen\n"
+        "<m.mieskolainen@imperial.ac.uk>\n"
+        "\n"
+        "<opensource.org/licenses/GPL-3.0>\n"
+        "<opensource.org/licenses/MIT>\n";
+    return s;
+  }();
+  std::cout.write(BANNER.data(), BANNER.size());
+  std::cout.flush();
 }
 
 // -------------------------------------------------------
 
-// Check do we have terminal output (=true), or output to file (=false)
-static const bool IS_TERMINAL = isatty(fileno(stdout)) != 0;
-
 // Print input arguments
 void PrintArgv(int argc, char *argv[]) {
-  std::cout << rang::fg::green << "$ ";
+  if (gra::aux::IS_TERMINAL) { std::cout.write(ANSI_GREEN, sizeof(ANSI_GREEN) - 1); }
+  std::cout << "$ ";
   for (int i = 0; i < argc; ++i) {
     const std::string s = std::string(argv[i]);
     if (s.find(' ') != std::string::npos) {  // e.g. "PP[CON]<F> -> pi+ pi-"
@@ -90,7 +118,8 @@ void PrintArgv(int argc, char *argv[]) {
       std::cout << s << " ";
     }
   }
-  std::cout << rang::fg::reset << std::endl;
+  if (gra::aux::IS_TERMINAL) { std::cout.write(ANSI_FG_RESET, sizeof(ANSI_FG_RESET) - 1); }
+  std::cout << std::endl;
 }
 
 // Download LHAPDFset automatically
@@ -101,12 +130,13 @@ void AutoDownloadLHAPDF(const std::string pdfname) {
   std::cout << std::endl;
 
   // Get instal path and remove "\n"
-  std::string INSTALLPATH = aux::ExecCommand("lhapdf-config --prefix");
-  INSTALLPATH.erase(std::remove(INSTALLPATH.begin(), INSTALLPATH.end(), '\n'), INSTALLPATH.end());
-
-  if (INSTALLPATH.find("command not found") != std::string::npos) {
+  std::string INSTALLPATH;
+  try {
+    INSTALLPATH = aux::ExecArgv({"lhapdf-config", "--prefix"});
+  } catch (const std::exception &e) {
     throw std::invalid_argument("aux::AutoDownloadLHAPDF: Failure: lhapdf-config command missing");
   }
+  INSTALLPATH.erase(std::remove(INSTALLPATH.begin(), INSTALLPATH.end(), '\n'), INSTALLPATH.end());
 
   // Download, untar
   std::string cmd1 = "wget http://lhapdfsets.web.cern.ch/lhapdfsets/current/" + pdfname +
@@ -117,16 +147,64 @@ void AutoDownloadLHAPDF(const std::string pdfname) {
 
 // Return timestamp in the given format
 std::string GetTimeStamp(const std::string format) {
-  std::time_t        t  = std::time(nullptr);
-  std::tm            tm = *std::localtime(&t);
-  std::ostringstream oss;
-  oss << std::put_time(&tm, format.c_str());
-  std::string timestamp(oss.str());
-
-  return timestamp;
+  // strftime straight into a stack buffer; the former ostringstream +
+  // put_time route paid stream construction and locale lookups per call,
+  // and localtime_r avoids the shared static tm of localtime
+  char        buf[128];
+  std::time_t t = std::time(nullptr);
+  struct tm   tstruct;
+  localtime_r(&t, &tstruct);
+  const std::size_t n = strftime(buf, sizeof(buf), format.c_str(), &tstruct);
+  return std::string(buf, n);
 }
 
 
+extern "C" char **environ;
+
+// Run a fixed-argv command directly and capture its output (stdout and
+// stderr) to std::string. Unlike ExecCommand/execsystem this does not go
+// through /bin/sh -c, so there is no shell fork or command-line parsing;
+// use those only when shell features (pipes, redirection) are needed.
+std::string ExecArgv(const std::vector<std::string> &args) {
+  if (args.empty()) { throw std::runtime_error("aux::ExecArgv: empty argument vector"); }
+
+  int fds[2];
+  if (pipe(fds) != 0) { throw std::runtime_error("aux::ExecArgv: pipe() failed!"); }
+
+  std::vector<char *> argv;
+  argv.reserve(args.size() + 1);
+  for (const auto &a : args) { argv.push_back(const_cast<char *>(a.c_str())); }
+  argv.push_back(nullptr);
+
+  // Child: both output streams into the pipe, both pipe ends closed
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+  posix_spawn_file_actions_adddup2(&actions, fds[1], STDERR_FILENO);
+  posix_spawn_file_actions_addclose(&actions, fds[0]);
+  posix_spawn_file_actions_addclose(&actions, fds[1]);
+
+  pid_t     pid = 0;
+  const int rc  = posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+  posix_spawn_file_actions_destroy(&actions);
+  close(fds[1]);
+
+  if (rc != 0) {
+    close(fds[0]);
+    throw std::runtime_error("aux::ExecArgv: cannot execute command '" + args[0] + "'");
+  }
+
+  std::string result;
+  char        buffer[4096];
+  ssize_t     n = 0;
+  while ((n = read(fds[0], buffer, sizeof(buffer))) > 0) { result.append(buffer, n); }
+  close(fds[0]);
+
+  int status = 0;
+  waitpid(pid, &status, 0);
+  return result;
+}
+
 // Run terminal command, get output to std::string
 std::string ExecCommand(const std::string &cmd) {
   std::array<char, 128>                    buffer;
@@ -160,10 +238,11 @@ std::string GetBasePath(std::size_t level) {
   char        sep = '/';
 
   for (std::size_t k = 0; k < level; ++k) {
-    // Search backwards from end of string
+    // Search backwards from end of string; resize in place instead of
+    // allocating a new substring per level
     size_t i = s.rfind(sep);
     if (i != std::string::npos) {
-      s = s.substr(0, i);
+      s.resize(i);
     } else {
       return s;
     }
@@ -204,26 +283,41 @@ std::uintmax_t GetFileSize(const std::string &filename) {
   return rc == 0 ? stat_buf.st_size : 0;
 }
 
-// Get Process Memory Usage (linux/BSD/OSX) in bytes
-void GetProcessMemory(double &peak_use, double &resident_use) {
-  // Peak memory
+// Get peak process memory usage (linux/BSD/OSX) in bytes
+double GetPeakMemory() {
   struct rusage rusage;
   getrusage(RUSAGE_SELF, &rusage);
-  peak_use = rusage.ru_maxrss * 1024L;
+  return rusage.ru_maxrss * 1024L;
+}
 
-  // Current memory
-  long  rss = 0L;
-  FILE *fp  = NULL;
-  if ((fp = fopen("/proc/self/statm", "r")) == NULL) {
-    resident_use = 0.0;
-    return;
-  }
-  if (fscanf(fp, "%*s%ld", &rss) != 1) {  // Reading problem
-    resident_use = 0.0;
-  } else {  // fine
-    resident_use = rss * (size_t)sysconf(_SC_PAGESIZE);
-  }
-  fclose(fp);
+// Get current resident process memory (linux) in bytes
+double GetResidentMemory() {
+  // One raw pread of /proc/self/statm and a direct parse of its 2nd field
+  // (resident pages); the FILE*/fscanf machinery is far heavier than this
+  // poll deserves. The page size never changes, so query it once, and keep
+  // the statm fd open across polls - procfs re-renders the contents on
+  // every read, so pread at offset 0 always returns fresh numbers
+  static const long PAGESIZE = sysconf(_SC_PAGESIZE);
+  static const int  statm_fd = ::open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+
+  if (statm_fd < 0) { return 0.0; }
+  char          buf[128];
+  const ssize_t n = ::pread(statm_fd, buf, sizeof(buf) - 1, 0);
+  if (n <= 0) { return 0.0; }  // Reading problem
+  buf[n] = '\0';
+
+  const char *p = buf;
+  while (*p != '\0' && *p != ' ') { ++p; }  // skip 1st field (total program size)
+  while (*p == ' ') { ++p; }
+  long rss = 0L;
+  while (*p >= '0' && *p <= '9') { rss = rss * 10 + (*p++ - '0'); }
+  return rss * static_cast<double>(PAGESIZE);
+}
+
+// Get Process Memory Usage (linux/BSD/OSX) in bytes
+void GetProcessMemory(double &peak_use, double &resident_use) {
+  peak_use     = GetPeakMemory();
+  resident_use = GetResidentMemory();
 }
 
 // Get disk usage
@@ -284,7 +378,7 @@ std::string DateTime() {
   time_t    now = time(0);
   struct tm tstruct;
   char      buf[80];
-  tstruct = *localtime(&now);
+  localtime_r(&now, &tstruct);  // thread-safe, no shared static tm
 
   strftime(buf, sizeof(buf), "%Y-%m-%d %X", &tstruct);
   return buf;
@@ -292,20 +386,33 @@ std::string DateTime() {
 
 // Print out progress bar visualization
 void PrintProgress(double ratio) {
+  if (!gra::aux::IS_TERMINAL) { return; }  // if no terminal, do not print!
   if (ratio > 1.0) { ratio = 1.0; }
 
 #define BAR "||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||"
   const int WIDTH = 62;
   const int pos   = static_cast<int>(ratio * 100);
+
+  // Re-draw only when the integer percent moves or 100 ms have passed.
+  // This function sits inside tight MC sampling loops, so between real
+  // updates it must be a no-op rather than a write+flush per call
+  static int                                         last_pos = -1;
+  static std::chrono::steady_clock::time_point       last_t   = std::chrono::steady_clock::now();
+  const std::chrono::steady_clock::time_point        now      = std::chrono::steady_clock::now();
+  if (pos == last_pos &&
+      std::chrono::duration_cast<std::chrono::milliseconds>(now - last_t).count() < 100) {
+    return;
+  }
+  last_pos = pos;
+  last_t   = now;
+
   const int left  = static_cast<int>(ratio * WIDTH);
   const int right = WIDTH - left;
 
-  if (gra::aux::IS_TERMINAL) {  // if no terminal, do not print!
-    std::cout << rang::fg::green;
-    printf("\r%3d%% [%.*s%*s]", pos, left, BAR, right, "");
-    std::cout << rang::fg::reset;
-    std::cout << std::flush;
-  }
+  std::cout.write(ANSI_GREEN, sizeof(ANSI_GREEN) - 1);
+  printf("\r%3d%% [%.*s%*s]", pos, left, BAR, right, "");
+  std::cout.write(ANSI_FG_RESET, sizeof(ANSI_FG_RESET) - 1);
+  std::cout << std::flush;
 }
 
 // Clear the line, and move cursor to the left
@@ -317,29 +424,162 @@ void ClearProgress() {
 // djb2 hash function (used for saving unique filenames)
 unsigned long djb2hash(const std::string &s) {
   unsigned long hash = 5381;  // Magic number
-  for (auto c : s) {
-    hash = (hash << 5) + hash + c;  // same as: hash * 33 + c
+
+  // Unrolled recurrence: eight characters advance the hash by
+  // hash*33^8 plus a sum of independent 33^k-weighted characters.
+  // Modular arithmetic makes this bit-identical to the one-byte loop,
+  // but the eight multiplies are independent, so the serial hash*33
+  // dependency chain no longer limits throughput on long strings
+  static constexpr unsigned long P33[8] = {42618442977UL, 1291467969UL, 39135393UL, 1185921UL,
+                                           35937UL,       1089UL,       33UL,       1UL};
+  static constexpr unsigned long P33_8  = 1406408618241UL;  // 33^8
+
+  std::size_t i = 0;
+  for (; i + 8 <= s.size(); i += 8) {
+    unsigned long h8 = 0;
+    for (int k = 0; k < 8; ++k) { h8 += P33[k] * static_cast<unsigned long>(s[i + k]); }
+    hash = hash * P33_8 + h8;
+  }
+  for (; i < s.size(); ++i) {
+    hash = (hash << 5) + hash + s[i];  // same as: hash * 33 + c
   }
   return hash;
 }
 
 // Read CSV file
 void ReadCSV(const std::string &inputfile, std::vector<std::vector<std::string>> &output) {
-  std::fstream file;
-  file.open(inputfile);
-  std::string line;
+  // Slurp the file once, then split in place by scanning for '\n' and ','
+  // with memchr; the old getline + istringstream pair built a stream object
+  // and re-allocated per line
+  const int fd = ::open(inputfile.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) { return; }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    ::close(fd);
+    return;
+  }
+  std::string data;
+  data.resize(st.st_size);
+  std::size_t got = 0;
+  while (got < static_cast<std::size_t>(st.st_size)) {
+    const ssize_t r = ::read(fd, &data[got], st.st_size - got);
+    if (r <= 0) { break; }
+    got += r;
+  }
+  ::close(fd);
+  data.resize(got);
+
+  // Count rows up front so output never reallocates
+  std::size_t nlines = std::count(data.begin(), data.end(), '\n');
+  if (!data.empty() && data.back() != '\n') { ++nlines; }
+  output.reserve(output.size() + nlines);
+
+  const char *p   = data.data();
+  const char *end = p + data.size();
+
+  while (p < end) {
+    const char *nl  = static_cast<const char *>(std::memchr(p, '\n', end - p));
+    const char *eol = (nl != nullptr) ? nl : end;
 
-  // Read every line from the stream
-  while (getline(file, line)) {
-    std::istringstream       stream(line);
     std::vector<std::string> columns;
-    std::string              element;
+    if (eol != p) { columns.reserve(std::count(p, eol, ',') + 1); }
 
     // Every line element separated by separator
-    while (getline(stream, element, ',')) { columns.push_back(element); }
-    output.push_back(columns);
+    const char *fb = p;
+    while (fb <= eol) {
+      const char *comma = static_cast<const char *>(std::memchr(fb, ',', eol - fb));
+      const char *fe    = (comma != nullptr) ? comma : eol;
+      columns.emplace_back(fb, fe - fb);
+      if (comma == nullptr) { break; }
+      fb = comma + 1;
+    }
+    // getline semantics: a trailing empty field is not stored
+    if (!columns.empty() && columns.back().empty()) { columns.pop_back(); }
+
+    output.push_back(std::move(columns));
+    p = (nl != nullptr) ? nl + 1 : end;
   }
-  file.close();
+}
+
+// Single linear pass turning JSON5 input into plain JSON:
+// strips // and /* */ comments, removes \n,\t,\r, compresses multi-space
+// runs away (a single space is kept), and drops trailing commas before
+// } or ]. Unlike the earlier regex passes this is aware of string
+// literals, so quoted content (including slashes and spaces) passes
+// through untouched.
+static std::string ScanJSON5(const std::string &in) {
+  std::string out;
+  out.reserve(in.size());
+
+  const std::size_t N       = in.size();
+  std::size_t       i       = 0;
+  std::size_t       nspaces = 0;  // plain spaces in the current whitespace run
+
+  // A run of whitespace (possibly interleaved with comments) compresses
+  // to one space if it held exactly one space character, else to nothing
+  auto flushspace = [&]() {
+    if (nspaces == 1) { out += ' '; }
+    nspaces = 0;
+  };
+
+  while (i < N) {
+    const char c = in[i];
+
+    // String literal: copy verbatim, honouring backslash escapes
+    if (c == '"' || c == '\'') {
+      flushspace();
+      const char quote = c;
+      out += in[i++];
+      while (i < N) {
+        out += in[i];
+        if (in[i] == '\\' && i + 1 < N) {  // escaped character
+          out += in[i + 1];
+          i += 2;
+          continue;
+        }
+        if (in[i] == quote) {
+          ++i;
+          break;
+        }
+        ++i;
+      }
+      continue;
+    }
+    // Comments emit nothing and do not break a whitespace run
+    if (c == '/' && i + 1 < N && in[i + 1] == '/') {  // single line
+      i += 2;
+      while (i < N && in[i] != '\n' && in[i] != '\r') { ++i; }
+      continue;
+    }
+    if (c == '/' && i + 1 < N && in[i + 1] == '*') {  // block
+      i += 2;
+      while (i + 1 < N && !(in[i] == '*' && in[i + 1] == '/')) { ++i; }
+      i = (i + 1 < N) ? i + 2 : N;
+      continue;
+    }
+    // Whitespace: only count it here, flushed at the next real character
+    if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+      if (c == ' ') { ++nspaces; }
+      ++i;
+      continue;
+    }
+    // Closing brace/bracket: drop a trailing comma left before it
+    if (c == '}' || c == ']') {
+      flushspace();
+      if (out.size() >= 2 && out[out.size() - 2] == ',' && out[out.size() - 1] == ' ') {
+        out.erase(out.size() - 2);
+      } else if (!out.empty() && out.back() == ',') {
+        out.pop_back();
+      }
+      out += c;
+      ++i;
+      continue;
+    }
+    flushspace();
+    out += c;
+    ++i;
+  }
+  return out;
 }
 
 // Get JSON file input
@@ -349,48 +589,51 @@ std::string GetInputData(const std::string &inputfile) {
     std::string str = "gra::aux::GetInputData: Inputfile '" + inputfile + "' does not exist";
     throw std::invalid_argument(str);
   }
-  // Create a JSON object from file
-  std::ifstream ifs(inputfile);
-  if (!ifs.is_open()) {
+  // Slurp the whole file with one read into a pre-sized string; the
+  // istreambuf_iterator form went byte-at-a-time through the streambuf
+  const int fd = ::open(inputfile.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
     throw std::invalid_argument("MAux::GetInputData: Error: Cannot open inputfile " + inputfile);
   }
-  std::string data((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    ::close(fd);
+    throw std::invalid_argument("MAux::GetInputData: Error: Cannot stat inputfile " + inputfile);
+  }
+  std::string data;
+  data.resize(st.st_size);
+  std::size_t got = 0;
+  while (got < static_cast<std::size_t>(st.st_size)) {
+    const ssize_t r = ::read(fd, &data[got], st.st_size - got);
+    if (r <= 0) { break; }
+    got += r;
+  }
+  ::close(fd);
+  data.resize(got);
 
   // https://json5.org/ features:
-  // We use C++11 raw string literals here R"(text)"
-  // so it is easier to type in expressions without problems with slashes
-
-  // JSON5: <Single and multi-line comments are allowed>
-  // First this. Remove C style block comments /* */
-  /*
-  data = std::regex_replace(data, std::regex(R"(\/\*(\*(?!\/)|[^*])*\*\/)"), "");
-  // Second this. Remove C++ style single line comments "//"
-  data = std::regex_replace(data, std::regex(R"([/]+.*)"), "");
-  */
-
-  // This removes C or C++ style comments and handles also slashes properly inside strings
-  data = std::regex_replace(data, std::regex(R"(//.*?(\r\n?|\n)|/\*.*?\*/)"), "");
-
-  // Remove "\n" or "\t" or "\r", needed for the following regex operations
-  data = std::regex_replace(data, std::regex(R"(\n|\t|\r)"), "");
-
-  // JSON5: <Additional white space characters are allowed.>
-  // Compress all extra spaces (compress to 1 space)
-  // This also processes through the strings "", not problems for use,
-  // but (IMPROVE THIS!)
-  data = std::regex_replace(data, std::regex(R"(\s{2,})"), "");
-
-  // JSON5: <Objects may have a single trailing comma.>
-  // Replace ",}" or ", }" with "}"
-  data = std::regex_replace(data, std::regex(R"(,}|, })"), "}");
-
-  // JSON5: <Arrays may have a single trailing comma.>
-  // Replace ",]" or ", ]" with "]"
-  data = std::regex_replace(data, std::regex(R"(,]|, ])"), "]");
-
-  // std::cout << std::endl << data << std::endl << std::endl;
+  // <Single and multi-line comments are allowed>
+  // <Additional white space characters are allowed.>
+  // <Objects may have a single trailing comma.>
+  // <Arrays may have a single trailing comma.>
+  //
+  // All handled by one linear scan; the old per-feature regex passes
+  // re-compiled and re-traversed the whole file four times over.
+  return ScanJSON5(data);
+}
 
-  return data;
+// Get JSON file input, parsed and cached per file: the PARAM_* blocks
+// and the resonance reader all pull from the same modelfile, so without
+// the cache the same file is read and parsed once per block. std::map
+// keeps references stable across later insertions.
+const nlohmann::json &GetInputJSON(const std::string &inputfile) {
+  static std::map<std::string, nlohmann::json> cache;
+  static std::mutex                            cache_lock;
+
+  const std::lock_guard<std::mutex> guard(cache_lock);
+  const auto                        it = cache.find(inputfile);
+  if (it != cache.end()) { return it->second; }
+  return cache.emplace(inputfile, nlohmann::json::parse(GetInputData(inputfile))).first->second;
 }
 
 // Check is it integer digits
@@ -455,64 +698,111 @@ std::string Spin2XtoString(int J2) {
 // Split a string to strings separated by delimiter
 std::vector<std::string> SplitStr2Str(std::string input, const char delim, bool trimextraspace) {
   std::vector<std::string> output;
-  std::stringstream        ss(input);
+  output.reserve(std::count(input.begin(), input.end(), delim) + 1);
 
-  // String by string
-  while (ss.good()) {
-    std::string substr;
-    std::getline(ss, substr, delim);
+  // Delimiter boundaries found with memchr, fields taken straight from
+  // the input; no stream objects or per-token re-allocation
+  const char *p = input.data();
+  const char *e = p + input.size();
+  while (true) {
+    const char *q = static_cast<const char *>(std::memchr(p, delim, e - p));
+    std::string substr(p, ((q != nullptr) ? q : e) - p);
 
     if (trimextraspace) { TrimExtraSpace(substr); }
-    output.push_back(substr);
+    output.push_back(std::move(substr));
+
+    if (q == nullptr) { break; }
+    p = q + 1;
   }
   return output;
 }
 
 // Split string to ints
 std::vector<int> SplitStr2Int(std::string input, const char delim) {
-  std::vector<int>  output;
-  std::stringstream ss(input);
+  std::vector<int> output;
+  output.reserve(std::count(input.begin(), input.end(), delim) + 1);
 
-  // Get inputfiles by comma
-  while (ss.good()) {
-    std::string substr;
-    std::getline(ss, substr, delim);
+  const char *p = input.data();
+  const char *e = p + input.size();
+  while (true) {
+    const char *q = static_cast<const char *>(std::memchr(p, delim, e - p));
+    std::string substr(p, ((q != nullptr) ? q : e) - p);
 
     TrimExtraSpace(substr);
     output.push_back(std::stoi(substr));
+
+    if (q == nullptr) { break; }
+    p = q + 1;
   }
   return output;
 }
 
 // Trim leading, extra and trailing spaces
+//
+// Plain in-place scans; these only need to locate space runs, for which
+// the regex engine was pure overhead on the short tokens coming out of
+// SplitStr2Str/SplitCommands
 void TrimExtraSpace(std::string &value) {
-  value = std::regex_replace(value, std::regex(R"(^ +| +$|( ) +)"), "$1");
+  // Collapse every interior space run to its first space, then strip ends
+  std::size_t w          = 0;
+  bool        prev_space = false;
+  for (const char c : value) {
+    if (c == ' ') {
+      if (!prev_space) { value[w++] = c; }
+      prev_space = true;
+    } else {
+      value[w++] = c;
+      prev_space = false;
+    }
+  }
+  value.resize(w);
+  TrimTrailSpace(value);
+  TrimLeadSpace(value);
 }
 
 void TrimLeadSpace(std::string &value) {
-  value = std::regex_replace(value, std::regex(R"(^ +)"), "$1");
+  const std::size_t i = value.find_first_not_of(' ');
+  value.erase(0, (i == std::string::npos) ? value.size() : i);
 }
 
 void TrimTrailSpace(std::string &value) {
-  value = std::regex_replace(value, std::regex(R"( +$)"), "$1");
+  const std::size_t i = value.find_last_not_of(' ');
+  value.erase((i == std::string::npos) ? 0 : i + 1);
 }
 
 void TrimEmptySpace(std::string &value) {
-  value = std::regex_replace(value, std::regex(R"( +)"), "$1");
+  std::size_t w = 0;
+  for (const char c : value) {
+    if (c != ' ') { value[w++] = c; }
+  }
+  value.resize(w);
 }
 
 void TrimAllSpace(std::string &value) {
-  value = std::regex_replace(value, std::regex(R"([^\S\r\n]+)"), "$1");
+  // All horizontal whitespace (keep \r and \n, as the old [^\S\r\n] did)
+  std::size_t w = 0;
+  for (const char c : value) {
+    if (!(c == ' ' || c == '\t' || c == '\f' || c == '\v')) { value[w++] = c; }
+  }
+  value.resize(w);
 }
 
 
 // Extract words from a string
 std::vector<std::string> Extract(const std::string &str) {
   std::vector<std::string> words;
-  std::stringstream        ss(str);
-  std::string              buff;
-
-  while (ss >> buff) { words.push_back(buff); }
+  words.reserve(str.size() / 8 + 1);  // heuristic, avoids the doubling steps
+
+  // Whitespace-delimited tokens, scanned in place (operator>> built a
+  // stream sentry and consulted the locale per token)
+  const char *p = str.data();
+  const char *e = p + str.size();
+  while (p < e) {
+    while (p < e && std::isspace(static_cast<unsigned char>(*p))) { ++p; }
+    const char *b = p;
+    while (p < e && !std::isspace(static_cast<unsigned char>(*p))) { ++p; }
+    if (b != p) { words.emplace_back(b, p - b); }
+  }
   return words;
 }
 
@@ -522,34 +812,64 @@ bool FileExist(const std::string &name) {
   return (stat(name.c_str(), &buffer) == 0);
 }
 
+// Banner bodies as plain static literals; the printers below emit them
+// with a single write instead of a chain of stream insertions
+namespace {
+
+constexpr char NOTICE_BODY[] =
+    "<NOTICE>\n\n"
+    "ZZZ    ZZ  ZZZZZZ  ZZZZZZZZ ZZ ZZZZZZ ZZZZZZZ  \n"
+    "ZZZZ   ZZ ZZ    ZZ    ZZ    ZZ ZZ     ZZ       \n"
+    "ZZ ZZ  ZZ ZZ    ZZ    ZZ    ZZ ZZ     ZZZZZ    \n"
+    "ZZ  ZZ ZZ ZZ    ZZ    ZZ    ZZ ZZ     ZZ       \n"
+    "ZZ   ZZZZ  ZZZZZZ     ZZ    ZZ ZZZZZZ ZZZZZZZ  \n";
+
+constexpr char WARNING_BODY[] =
+    "<WARNING>\n\n"
+    "ZZ     ZZ  ZZZZZ  ZZZZZZ  ZZZ    ZZ ZZ ZZZ    ZZ  ZZZZZZ   \n"
+    "ZZ     ZZ ZZ   ZZ ZZ   ZZ ZZZZ   ZZ ZZ ZZZZ   ZZ ZZ        \n"
+    "ZZ  Z  ZZ ZZZZZZZ ZZZZZZ  ZZ ZZ  ZZ ZZ ZZ ZZ  ZZ ZZ   ZZZ  \n"
+    "ZZ ZZZ ZZ ZZ   ZZ ZZ   ZZ ZZ  ZZ ZZ ZZ ZZ  ZZ ZZ ZZ    ZZ  \n"
+    " ZZZ ZZZ  ZZ   ZZ ZZ   ZZ ZZ   ZZZZ ZZ ZZ   ZZZZ  ZZZZZZ   \n";
+
+constexpr char GAMEOVER_BODY[] =
+    "<GAME OVER>\n\n"
+    " ZZZZZZ   ZZZZZ  ZZZ    ZZZ ZZZZZZZ    ZZZZZZ  ZZ    ZZ ZZZZZZZ ZZZZZZ   \n"
+    "ZZ       ZZ   ZZ ZZZZ  ZZZZ ZZ        ZZ    ZZ ZZ    ZZ ZZ      ZZ   ZZ  \n"
+    "ZZ   ZZZ ZZZZZZZ ZZ ZZZZ ZZ ZZZZZ     ZZ    ZZ ZZ    ZZ ZZZZZ   ZZZZZZ   \n"
+    "ZZ    ZZ ZZ   ZZ ZZ  ZZ  ZZ ZZ        ZZ    ZZ  ZZ  ZZ  ZZ      ZZ   ZZ  \n"
+    " ZZZZZZ  ZZ   ZZ ZZ      ZZ ZZZZZZZ    ZZZZZZ    ZZZZ   ZZZZZZZ ZZ   ZZ  \n";
+
+// Red body + trailing newline rendered once per process (IS_TERMINAL
+// chooses the colored or plain variant at startup)
+std::string RenderRedBanner(const char *body) {
+  std::string s;
+  if (IS_TERMINAL) {
+    s = std::string(ANSI_RED) + body + ANSI_FG_RESET + "\n";
+  } else {
+    s = std::string(body) + "\n";
+  }
+  return s;
+}
+
+}  // namespace
+
 void PrintNotice() {
-  std::cout << rang::fg::red << "<NOTICE>\n\n"
-            << "ZZZ    ZZ  ZZZZZZ  ZZZZZZZZ ZZ ZZZZZZ ZZZZZZZ  \n"
-               "ZZZZ   ZZ ZZ    ZZ    ZZ    ZZ ZZ     ZZ       \n"
-               "ZZ ZZ  ZZ ZZ    ZZ    ZZ    ZZ ZZ     ZZZZZ    \n"
-               "ZZ  ZZ ZZ ZZ    ZZ    ZZ    ZZ ZZ     ZZ       \n"
-               "ZZ   ZZZZ  ZZZZZZ     ZZ    ZZ ZZZZZZ ZZZZZZZ  \n"
-            << rang::fg::reset << std::endl;
+  static const std::string BANNER = RenderRedBanner(NOTICE_BODY);
+  std::cout.write(BANNER.data(), BANNER.size());
+  std::cout.flush();
 }
 
 void PrintWarning() {
-  std::cout << rang::fg::red << "<WARNING>\n\n"
-            << "ZZ     ZZ  ZZZZZ  ZZZZZZ  ZZZ    ZZ ZZ ZZZ    ZZ  ZZZZZZ   \n"
-               "ZZ     ZZ ZZ   ZZ ZZ   ZZ ZZZZ   ZZ ZZ ZZZZ   ZZ ZZ        \n"
-               "ZZ  Z  ZZ ZZZZZZZ ZZZZZZ  ZZ ZZ  ZZ ZZ ZZ ZZ  ZZ ZZ   ZZZ  \n"
-               "ZZ ZZZ ZZ ZZ   ZZ ZZ   ZZ ZZ  ZZ ZZ ZZ ZZ  ZZ ZZ ZZ    ZZ  \n"
-               " ZZZ ZZZ  ZZ   ZZ ZZ   ZZ ZZ   ZZZZ ZZ ZZ   ZZZZ  ZZZZZZ   \n"
-            << rang::fg::reset << std::endl;
+  static const std::string BANNER = RenderRedBanner(WARNING_BODY);
+  std::cout.write(BANNER.data(), BANNER.size());
+  std::cout.flush();
 }
 
 void PrintGameOver() {
-  std::cout << "<GAME OVER>\n\n"
-            << " ZZZZZZ   ZZZZZ  ZZZ    ZZZ ZZZZZZZ    ZZZZZZ  ZZ    ZZ ZZZZZZZ ZZZZZZ   \n"
-               "ZZ       ZZ   ZZ ZZZZ  ZZZZ ZZ        ZZ    ZZ ZZ    ZZ ZZ      ZZ   ZZ  \n"
-               "ZZ   ZZZ ZZZZZZZ ZZ ZZZZ ZZ ZZZZZ     ZZ    ZZ ZZ    ZZ ZZZZZ   ZZZZZZ   \n"
-               "ZZ    ZZ ZZ   ZZ ZZ  ZZ  ZZ ZZ        ZZ    ZZ  ZZ  ZZ  ZZ      ZZ   ZZ  \n"
-               " ZZZZZZ  ZZ   ZZ ZZ      ZZ ZZZZZZZ    ZZZZZZ    ZZZZ   ZZZZZZZ ZZ   ZZ  \n"
-            << std::endl;
+  std::cout.write(GAMEOVER_BODY, sizeof(GAMEOVER_BODY) - 1);
+  std::cout.put('\n');
+  std::cout.flush();
 }
 
 
@@ -568,8 +888,89 @@ std::string execsystem(const char *cmd) {
 }
 
 
-// Check updates online
-void CheckUpdate() {
+// SAX handler picking only the {version, date, update} fields out of
+// VERSION.json; a full DOM parse would allocate a variant tree just to
+// read three values
+namespace {
+struct VersionSAX final : public nlohmann::json_sax<nlohmann::json> {
+  std::string last_key;
+
+  double      version     = 0.0;
+  bool        has_version = false;
+  std::string date;
+  std::string update;
+
+  bool key(string_t &val) override {
+    last_key = val;
+    return true;
+  }
+  bool string(string_t &val) override {
+    if (last_key == "date") {
+      date = val;
+    } else if (last_key == "update") {
+      update = val;
+    }
+    return true;
+  }
+  bool number_float(number_float_t val, const string_t & /*s*/) override {
+    if (last_key == "version") {
+      version     = val;
+      has_version = true;
+    }
+    return true;
+  }
+  bool number_integer(number_integer_t val) override {
+    if (last_key == "version") {
+      version     = static_cast<double>(val);
+      has_version = true;
+    }
+    return true;
+  }
+  bool number_unsigned(number_unsigned_t val) override {
+    if (last_key == "version") {
+      version     = static_cast<double>(val);
+      has_version = true;
+    }
+    return true;
+  }
+  // Structure and values we do not care about
+  bool null() override { return true; }
+  bool boolean(bool /*val*/) override { return true; }
+  bool binary(binary_t & /*val*/) override { return true; }
+  bool start_object(std::size_t /*elements*/) override { return true; }
+  bool end_object() override { return true; }
+  bool start_array(std::size_t /*elements*/) override { return true; }
+  bool end_array() override { return true; }
+  bool parse_error(std::size_t /*position*/, const std::string & /*last_token*/,
+                   const nlohmann::detail::exception & /*ex*/) override {
+    return false;
+  }
+};
+}  // namespace
+
+// Start the online version query in the background. The curl subprocess
+// dominates CheckUpdate wall time, so callers can fire it early, keep
+// doing useful work and join with a timeout when the answer is wanted
+std::shared_future<std::string> FireCheckUpdate() {
+  return std::async(std::launch::async, []() -> std::string {
+    // No shell needed for a fixed argv; ExecArgv captures stderr too,
+    // as the old "&> /dev/stdout" redirection did
+    try {
+      return ExecArgv({"curl", "-s",
+                       "https://raw.githubusercontent.com/mieskolainen/GRANIITTI/master/VERSION.json"});
+    } catch (const std::exception &e) {
+      return "";  // curl not available; handled as an empty response
+    }
+  });
+}
+
+// Blocking convenience wrapper
+void CheckUpdate() { JoinCheckUpdate(FireCheckUpdate()); }
+
+// Wait up to timeout_ms for the fetch fired by FireCheckUpdate and print
+// the version comparison; on timeout or fetch failure print the
+// could-not-update notice instead of blocking
+void JoinCheckUpdate(std::shared_future<std::string> future, int timeout_ms) {
   auto PrintMessage = []() {
     std::cout << std::endl;
     PrintBar("-", 80);
@@ -579,19 +980,20 @@ void CheckUpdate() {
     std::cout << std::endl;
   };
 
-  const std::string cmd =
-      "curl -s https://raw.githubusercontent.com/mieskolainen/GRANIITTI/master/VERSION.json &> "
-      "/dev/stdout";
-  const std::string data = execsystem(cmd.c_str());
+  std::string data;
+  if (future.valid() &&
+      future.wait_for(std::chrono::milliseconds(timeout_ms)) == std::future_status::ready) {
+    data = future.get();
+  }
 
   if (data.size() > 0) {
-    nlohmann::json j;
+    // Pull out just the three fields via SAX; no DOM tree needed
+    VersionSAX sax;
+    const bool ok = nlohmann::json::sax_parse(data, &sax);
 
-    try {
-      j = nlohmann::json::parse(data);
-
-      const double      online_version = j.at("version");
-      const std::string online_date    = j.at("date");
+    if (ok && sax.has_version && !sax.date.empty()) {
+      const double       online_version = sax.version;
+      const std::string &online_date    = sax.date;
 
       if (GetVersion() < online_version) {  // Older version than online
         std::cout << std::endl;
@@ -600,7 +1002,7 @@ void CheckUpdate() {
                   << " (" << online_date << ") available at <github.com/mieskolainen/graniitti>"
                   << rang::fg::reset << rang::style::reset << std::endl;
         std::cout << std::endl;
-        std::cout << "Updates are: " << j.at("update") << std::endl;
+        std::cout << "Updates are: \"" << sax.update << "\"" << std::endl;
         std::cout << std::endl;
         std::cout << "To update, copy-and-run: " << std::endl;
         std::cout
@@ -631,7 +1033,9 @@ void CheckUpdate() {
         std::cout << std::endl;
       }
 
-    } catch (...) { PrintMessage(); }
+    } else {  // Parse failure or fields missing
+      PrintMessage();
+    }
   } else {
     PrintMessage();
   }
@@ -653,40 +1057,36 @@ void CreateVersionJSON() {
   fclose(file);
 }
 
-std::string bool_cast(bool b) {
-  std::ostringstream ss;
-  ss << std::boolalpha << b;
-  return ss.str();
-}
+std::string bool_cast(bool b) { return b ? "true" : "false"; }
+
+// The version banners are built from compile-time constants, so each is
+// formatted once and served from a function-local static thereafter
 
 std::string GetVersionString() {
-  char buff[100];
-  snprintf(buff, sizeof(buff), "Version %0.3f (%s) %s", GetVersion(), GetVersionType().c_str(),
-           GetVersionDate().c_str());
-  std::string str = buff;
-  return str;
+  static const std::string cached = []() {
+    char buff[100];
+    snprintf(buff, sizeof(buff), "Version %0.3f (%s) %s", VERSION, VERSION_TYPE, VERSION_DATE);
+    return std::string(buff);
+  }();
+  return cached;
 }
 
 std::string GetVersionTLatex() {
-  char         buff[100];
-  const double version = GetVersion();
-  snprintf(buff, sizeof(buff), "#color[16]{#scale[0.6]{GRANIITTI #scale[0.8]{%0.3f}}}", version);
-  std::string str = buff;
-  return str;
+  static const std::string cached = []() {
+    char buff[100];
+    snprintf(buff, sizeof(buff), "#color[16]{#scale[0.6]{GRANIITTI #scale[0.8]{%0.3f}}}", VERSION);
+    return std::string(buff);
+  }();
+  return cached;
 }
 
-std::string GetWebTLatex() {
-  char buff[100];
-  snprintf(buff, sizeof(buff), "#color[16]{#scale[0.5]{#LTgithub.com/mieskolainen#GT}}");
-  std::string str = buff;
-  return str;
-}
+std::string GetWebTLatex() { return "#color[16]{#scale[0.5]{#LTgithub.com/mieskolainen#GT}}"; }
 
 void PrintFlashScreen(rang::fg pcolor) {
-  std::cout << std::endl;
-  gra::aux::PrintBar("-");
-  std::cout << pcolor
-            << ".``````````````````````     ````   ``                        ``   ```   ``\n"
+  // The art block is a fixed literal; only the foreground color varies
+  // per call, so write escape + art + reset instead of streaming every row
+  static constexpr char ART[] =
+      ".``````````````````````     ````   ``                        ``   ```   ``\n"
                ".```..````````````    ` ``          `                             ``    ``\n"
                ".``..:``````````` ```.``````.`.```                                 `    ``\n"
                ".``.`.```````   ````     ``-.```.````                               ``` ``\n"
@@ -709,10 +1109,22 @@ void PrintFlashScreen(rang::fg pcolor) {
                "``.//-/++-sh+-.-..`-`.-.--.- :hhho/+//:/yyyhhs+::+o+/++ssssso:.`-::oyssyyy\n"
                "`/yhoshhhh////++:.....`:yy+/...sddhs/:////:-/++ooo+oyssyoo:.`:/+oosssshddd\n"
                "`dddyhydhdyyddhddo``.+.`+/oyoh-..+yddho/-......--:----://+osyyhho++/--::/+\n"
-               "/hddhmhmhmdmddhdds:+s+:+/-:++hhh//.-/++osssso++/-.````.-://::-.....`......\n"
-            << std::endl
-            << std::endl;
-  std::cout << rang::fg::reset;
+      "/hddhmhmhmdmddhdds:+s+:+/-:++hhh//.-/++osssso++/-.````.-://::-.....`......\n";
+
+  std::cout.put('\n');
+  gra::aux::PrintBar("-");
+  if (IS_TERMINAL) {
+    char esc[8];
+    const int n = snprintf(esc, sizeof(esc), "\x1b[%dm", static_cast<int>(pcolor));
+    std::cout.write(esc, n);
+    std::cout.write(ART, sizeof(ART) - 1);
+    std::cout.write("\n\n", 2);
+    std::cout.write(ANSI_FG_RESET, sizeof(ANSI_FG_RESET) - 1);
+  } else {
+    std::cout.write(ART, sizeof(ART) - 1);
+    std::cout.write("\n\n", 2);
+  }
+  std::cout.flush();
 }
 
 
@@ -730,40 +1142,31 @@ void CreateDirectory(std::string fullpath) {
 
 // Get commandline arguments which are split by @... @... tagging syntax
 std::vector<OneCMD> SplitCommands(const std::string &fullstr) {
-  // Find @ blocks [ ... ]
-  std::vector<std::size_t> pos = FindOccurance(fullstr, "@");
-  std::vector<std::string> subcmd;
-
-  if (pos.size() != 0) {
-    // Take full string from the first @ till end
-    std::string str = fullstr.substr(pos[0]);
-
-    // Split multiple @id{} @id{} ... @id{} occurances
-    if (pos.size() >= 2) {
-      for (std::size_t i = 0; i < pos.size(); ++i) {
-        const int start = pos[i] + 1;  // +1 so we skip @
-        const int end   = (i < pos.size() - 1) ? pos[i + 1] : str.size();
-        subcmd.push_back(str.substr(start, end - start));
-      }
-    } else {
-      subcmd.push_back(str.substr(1));  // +1 so we skip @
-    }
-  }
-
-  // Loop over @ blocks
   std::vector<OneCMD> cmd;
 
-  for (std::size_t i = 0; i < subcmd.size(); ++i) {
+  // Single pass over @ ... @ ... blocks; each block is materialized and
+  // trimmed once, then lexed in place (no substring-of-substring chains)
+  const char *      data = fullstr.data();
+  const std::size_t N    = fullstr.size();
+
+  const void *first = std::memchr(data, '@', N);
+  if (first == nullptr) { return cmd; }
+
+  std::size_t begin = static_cast<const char *>(first) - data + 1;  // +1 so we skip @
+
+  while (begin <= N) {
+    const void *      next = (begin < N) ? std::memchr(data + begin, '@', N - begin) : nullptr;
+    const std::size_t end  = (next != nullptr) ? static_cast<const char *>(next) - data : N;
+
     // ** Remove whitespace **
-    TrimExtraSpace(subcmd[i]);
+    std::string sub(data + begin, end - begin);
+    TrimExtraSpace(sub);
 
-    std::string                        id;
-    std::vector<std::string>           target;
-    std::map<std::string, std::string> arg;
+    OneCMD o;
 
     // Check we find [] brackets
-    std::size_t left  = subcmd[i].find("[");
-    std::size_t right = subcmd[i].find("]");
+    const std::size_t left  = sub.find('[');
+    const std::size_t right = sub.find(']');
 
     // Incomplete brackets
     if (left == std::string::npos && right != std::string::npos) {
@@ -776,18 +1179,17 @@ std::vector<OneCMD> SplitCommands(const std::string &fullstr) {
     // Found [] brackets
     else if (left != std::string::npos && right != std::string::npos) {
       // Read (multiple) targets out
-      const std::string TARGET_str = subcmd[i].substr(left + 1, right - left - 1);
-      if (TARGET_str != "") {  // do not process empty
-        target = SplitStr2Str(TARGET_str, ',');
+      if (right - left > 1) {  // do not process empty
+        o.target = SplitStr2Str(sub.substr(left + 1, right - left - 1), ',');
       }
 
       // Remove [...] block including brackets
-      subcmd[i].erase(left, right - left + 1);
+      sub.erase(left, right - left + 1);
     }
 
     // Check we find {} brackets
-    std::size_t Lpos = subcmd[i].find("{", 0);
-    std::size_t Rpos = subcmd[i].find("}", 0);
+    const std::size_t Lpos = sub.find('{');
+    const std::size_t Rpos = sub.find('}');
 
     // Incomplete brackets
     if (Lpos == std::string::npos && Rpos != std::string::npos) {
@@ -800,30 +1202,29 @@ std::vector<OneCMD> SplitCommands(const std::string &fullstr) {
 
     // Singlet command @ID:VALUE
     if (Lpos == std::string::npos && Rpos == std::string::npos) {
-      std::vector<std::string> strip = SplitStr2Str(subcmd[i], ':');
+      std::vector<std::string> strip = SplitStr2Str(sub, ':');
 
       // ID
-      id = strip[0];
+      o.id = std::move(strip[0]);
 
       if (strip.size() == 1) {
-        arg["_SINGLET_"] = "true";  // default true, no : given
+        o.arg["_SINGLET_"] = "true";  // default true, no : given
       } else if (strip.size() == 2) {
-        arg["_SINGLET_"] = strip[1];
+        o.arg["_SINGLET_"] = std::move(strip[1]);
       } else {
-        throw std::invalid_argument("gra::SplitCommands: @Syntax invalid with '" + subcmd[i] + "'");
+        throw std::invalid_argument("gra::SplitCommands: @Syntax invalid with '" + sub + "'");
       }
 
       // Block command @blaa{key:val,key:val,...}
     } else {  // We have {} block
 
       // ID
-      id = subcmd[i].substr(0, Lpos);
+      o.id = sub.substr(0, Lpos);
 
       // Content {}
 
       // Now split all arguments inside {} by comma ','
-      std::vector<std::string> keyvals =
-          SplitStr2Str(subcmd[i].substr(Lpos + 1, Rpos - Lpos - 1), ',');
+      std::vector<std::string> keyvals = SplitStr2Str(sub.substr(Lpos + 1, Rpos - Lpos - 1), ',');
 
       // Add all
       for (std::size_t i = 0; i < keyvals.size(); ++i) {
@@ -837,17 +1238,16 @@ std::vector<OneCMD> SplitCommands(const std::string &fullstr) {
         // Strip spaces from the key
         TrimExtraSpace(strip[0]);
 
-        arg[strip[0]] = strip[1];  // add to map
+        o.arg[std::move(strip[0])] = std::move(strip[1]);  // add to map
       }
     }
 
     // Add this command block
-    OneCMD o;
-    o.id     = id;
-    o.target = target;
-    o.arg    = arg;
     o.Print();  // For debug
-    cmd.push_back(o);
+    cmd.push_back(std::move(o));
+
+    if (next == nullptr) { break; }
+    begin = end + 1;
   }
   return cmd;
 }
@@ -856,8 +1256,25 @@ std::vector<OneCMD> SplitCommands(const std::string &fullstr) {
 std::vector<std::size_t> FindOccurance(const std::string &str, const std::string &sub) {
   // Holds all the positions that sub occurs within str
   std::vector<size_t> positions;
-  std::size_t         pos = str.find(sub, 0);
 
+  // Single-character needle (the common case, e.g. '@' in SplitCommands):
+  // scan with memchr, which libc vectorizes to many bytes per iteration
+  if (sub.size() == 1) {
+    const char *      data = str.data();
+    const std::size_t n    = str.size();
+    positions.reserve(std::count(str.begin(), str.end(), sub[0]));
+    std::size_t off = 0;
+    while (off < n) {
+      const void *q = std::memchr(data + off, sub[0], n - off);
+      if (q == nullptr) { break; }
+      const std::size_t pos = static_cast<const char *>(q) - data;
+      positions.push_back(pos);
+      off = pos + 1;
+    }
+    return positions;
+  }
+
+  std::size_t pos = str.find(sub, 0);
   while (pos != std::string::npos) {
     positions.push_back(pos);
     pos = str.find(sub, pos + 1);
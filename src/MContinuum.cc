@@ -28,6 +28,7 @@
 using gra::aux::indices;
 using gra::math::abs2;
 using gra::math::msqrt;
+using gra::math::OnShellEnergy;
 using gra::math::PI;
 using gra::math::pow2;
 using gra::math::pow3;
@@ -36,6 +37,71 @@ using gra::math::zi;
 using gra::PDG::GeV2barn;
 
 namespace gra {
+
+// Inverse system matrices A^{-1} for Kf = 2...8 in one flat, contiguous,
+// zero-padded block (aggregate init zero-fills the tail of each row), so
+// selecting a block is one pointer and the inner product walks one row
+namespace {
+
+constexpr double BLS_A[MContinuum::BLS_KFMAX - 1][MContinuum::BLS_KFMAX][MContinuum::BLS_KFMAX] = {
+    // Kf = 2
+    {{1.0 / 2.0, 0.0}, {0.0, 1.0 / 2.0}},
+
+    // Kf = 3
+    {{2.0 / 3.0, 0.0, -1.0 / 3.0},
+     {1.0 / 6.0, 1.0 / 2.0, -1.0 / 3.0},
+     {-1.0 / 3.0, 0.0, 2.0 / 3.0}},
+
+    // Kf = 4
+    {{7.0 / 8.0, 1.0 / 8.0, -1.0 / 2.0, -1.0 / 4.0},
+     {3.0 / 8.0, 5.0 / 8.0, -1.0 / 2.0, -1.0 / 4.0},
+     {-1.0 / 8.0, 1.0 / 8.0, 1.0 / 2.0, -1.0 / 4.0},
+     {-5.0 / 8.0, -3.0 / 8.0, 1.0 / 2.0, 3.0 / 4.0}},
+
+    // Kf = 5
+    {{11.0 / 10.0, 3.0 / 10.0, -3.0 / 5.0, -2.0 / 5.0, -1.0 / 5.0},
+     {3.0 / 5.0, 4.0 / 5.0, -3.0 / 5.0, -2.0 / 5.0, -1.0 / 5.0},
+     {1.0 / 10.0, 3.0 / 10.0, 2.0 / 5.0, -2.0 / 5.0, -1.0 / 5.0},
+     {-2.0 / 5.0, -1.0 / 5.0, 2.0 / 5.0, 3.0 / 5.0, -1.0 / 5.0},
+     {-9.0 / 10.0, -7.0 / 10.0, 2.0 / 5.0, 3.0 / 5.0, 4.0 / 5.0}},
+
+    // Kf = 6
+    {{4.0 / 3.0, 1.0 / 2.0, -2.0 / 3.0, -1.0 / 2.0, -1.0 / 3.0, -1.0 / 6.0},
+     {5.0 / 6.0, 1.0 / 1.0, -2.0 / 3.0, -1.0 / 2.0, -1.0 / 3.0, -1.0 / 6.0},
+     {1.0 / 3.0, 1.0 / 2.0, 1.0 / 3.0, -1.0 / 2.0, -1.0 / 3.0, -1.0 / 6.0},
+     {-1.0 / 6.0, 0.0, 1.0 / 3.0, 1.0 / 2.0, -1.0 / 3.0, -1.0 / 6.0},
+     {-2.0 / 3.0, -1.0 / 2.0, 1.0 / 3.0, 1.0 / 2.0, 2.0 / 3.0, -1.0 / 6.0},
+     {-7.0 / 6.0, -1.0 / 1.0, 1.0 / 3.0, 1.0 / 2.0, 2.0 / 3.0, 5.0 / 6.0}},
+
+    // Kf = 7
+    {{11.0 / 7.0, 5.0 / 7.0, -5.0 / 7.0, -4.0 / 7.0, -3.0 / 7.0, -2.0 / 7.0, -1.0 / 7.0},
+     {15.0 / 14.0, 17.0 / 14.0, -5.0 / 7.0, -4.0 / 7.0, -3.0 / 7.0, -2.0 / 7.0, -1.0 / 7.0},
+     {4.0 / 7.0, 5.0 / 7.0, 2.0 / 7.0, -4.0 / 7.0, -3.0 / 7.0, -2.0 / 7.0, -1.0 / 7.0},
+     {1.0 / 14.0, 3.0 / 14.0, 2.0 / 7.0, 3.0 / 7.0, -3.0 / 7.0, -2.0 / 7.0, -1.0 / 7.0},
+     {-3.0 / 7.0, -2.0 / 7.0, 2.0 / 7.0, 3.0 / 7.0, 4.0 / 7.0, -2.0 / 7.0, -1.0 / 7.0},
+     {-13.0 / 14.0, -11.0 / 14.0, 2.0 / 7.0, 3.0 / 7.0, 4.0 / 7.0, 5.0 / 7.0, -1.0 / 7.0},
+     {-10.0 / 7.0, -9.0 / 7.0, 2.0 / 7.0, 3.0 / 7.0, 4.0 / 7.0, 5.0 / 7.0, 6.0 / 7.0}},
+
+    // Kf = 8
+    {{29.0 / 16.0, 15.0 / 16.0, -3.0 / 4.0, -5.0 / 8.0, -1.0 / 2.0, -3.0 / 8.0, -1.0 / 4.0,
+      -1.0 / 8.0},
+     {21.0 / 16.0, 23.0 / 16.0, -3.0 / 4.0, -5.0 / 8.0, -1.0 / 2.0, -3.0 / 8.0, -1.0 / 4.0,
+      -1.0 / 8.0},
+     {13.0 / 16.0, 15.0 / 16.0, 1.0 / 4.0, -5.0 / 8.0, -1.0 / 2.0, -3.0 / 8.0, -1.0 / 4.0,
+      -1.0 / 8.0},
+     {5.0 / 16.0, 7.0 / 16.0, 1.0 / 4.0, 3.0 / 8.0, -1.0 / 2.0, -3.0 / 8.0, -1.0 / 4.0,
+      -1.0 / 8.0},
+     {-3.0 / 16.0, -1.0 / 16.0, 1.0 / 4.0, 3.0 / 8.0, 1.0 / 2.0, -3.0 / 8.0, -1.0 / 4.0,
+      -1.0 / 8.0},
+     {-11.0 / 16.0, -9.0 / 16.0, 1.0 / 4.0, 3.0 / 8.0, 1.0 / 2.0, 5.0 / 8.0, -1.0 / 4.0,
+      -1.0 / 8.0},
+     {-19.0 / 16.0, -17.0 / 16.0, 1.0 / 4.0, 3.0 / 8.0, 1.0 / 2.0, 5.0 / 8.0, 3.0 / 4.0,
+      -1.0 / 8.0},
+     {-27.0 / 16.0, -25.0 / 16.0, 1.0 / 4.0, 3.0 / 8.0, 1.0 / 2.0, 5.0 / 8.0, 3.0 / 4.0,
+      7.0 / 8.0}}};
+
+}  // namespace
+
 // This is needed by construction
 MContinuum::MContinuum() { Initialize(); }
 
@@ -45,9 +111,6 @@ MContinuum::MContinuum(std::string process, const std::vector<aux::OneCMD> &synt
   InitHistograms();
   SetProcess(process, syntax);
 
-  // Init final states
-  M4Vec zerovec(0, 0, 0, 0);
-  for (std::size_t i = 0; i < 10; ++i) { lts.pfinal.push_back(zerovec); }
   std::cout << "MContinuum:: [Constructor done]" << std::endl;
 }
 
@@ -86,6 +149,38 @@ void MContinuum::post_Constructor() {
 
   if (EXCITATION == 1) { ProcPtr.LIPSDIM += 1; }
   if (EXCITATION == 2) { ProcPtr.LIPSDIM += 2; }
+
+  // Fold the run-constant pieces of the sampling map and the phase-space
+  // weight once; Nf and the generation cuts are fixed for the whole
+  // integration, so none of this belongs in the per-event path
+  const unsigned int Kf = lts.decaytree.size();
+  const unsigned int Nf = Kf + 2;
+
+  log_fwd_pt_min_   = std::log(gcuts.forward_pt_min + ZERO_EPS);
+  log_fwd_pt_max_   = std::log(gcuts.forward_pt_max);
+  log_fwd_pt_range_ = log_fwd_pt_max_ - log_fwd_pt_min_;
+  kt_span_          = gcuts.kt_max - gcuts.kt_min;
+  rap_span_         = gcuts.rap_max - gcuts.rap_min;
+  kt_volume_ = std::pow(kt_span_, Kf - 1) * std::pow(2.0 * PI, Kf - 1) * std::pow(rap_span_, Kf);
+  ps_norm_ = (1.0 / std::pow(2, 2 * (Nf - 2))) * (1.0 / std::pow(2.0 * PI, 3 * Nf - 4));
+
+  // Active final state slots: central system + 2 forward legs + Kf central
+  lts.pfinal_n = Kf + 3;
+
+  // Stable (zero-width) first-level legs have delta-function offshell
+  // masses: preset them once and skip the per-event sampling loop
+  zero_width_legs_ = true;
+  for (const auto &i : indices(lts.decaytree)) {
+    if (lts.decaytree[i].p.width >= 1e-40) {
+      zero_width_legs_ = false;
+      break;
+    }
+  }
+  if (zero_width_legs_) {
+    for (const auto &i : indices(lts.decaytree)) {
+      lts.decaytree[i].m_offshell = lts.decaytree[i].p.mass;
+    }
+  }
 }
 
 // Update kinematics (screening kT loop calls this)
@@ -101,59 +196,59 @@ bool MContinuum::LoopKinematics(const std::vector<double> &p1p, const std::vecto
   lts.pfinal[2].SetPxPy(p2p[0], p2p[1]);
 
   // Get central final states pT degrees of freedom
-  std::vector<M4Vec> p(Kf, M4Vec(0, 0, 0, 0));
-  BLinearSystem(p, pkt_, lts.pfinal[1], lts.pfinal[2]);
-
-  // Set central particles px,py,pz,e
+  // (px,py written straight into the pfinal slots)
   const unsigned int offset = 3;  // indexing
-  M4Vec              sumP(0, 0, 0, 0);
+  BLinearSystem(&lts.pfinal[offset], Kf, pkt_, lts.pfinal[1], lts.pfinal[2]);
+
+  // Set central particles pz,e
+  // (system sum accumulated in scalar registers in the same sweep)
+  double sx = 0.0, sy = 0.0, sz = 0.0, se = 0.0;
   for (std::size_t i = 0; i < Kf; ++i) {
     const double y = lts.pfinal_orig[i + offset].Rap();
     const double m = lts.pfinal_orig[i + offset].M();
 
-    // px,py
-    lts.pfinal[i + offset].SetPxPy(p[i].Px(), p[i].Py());
-
-    // pz,E
+    // pz,E (one exp instead of separate sinh and cosh calls)
     const double mt = msqrt(pow2(m) + lts.pfinal[i + offset].Pt2());
-    lts.pfinal[i + offset].SetPzE(mt * std::sinh(y), mt * std::cosh(y));
-
-    sumP += lts.pfinal[i + offset];
+    double       sh = 0.0, ch = 0.0;
+    gra::math::msinhcosh(y, sh, ch);
+    lts.pfinal[i + offset].SetPzE(mt * sh, mt * ch);
+
+    sx += lts.pfinal[i + offset].Px();
+    sy += lts.pfinal[i + offset].Py();
+    sz += lts.pfinal[i + offset].Pz();
+    se += lts.pfinal[i + offset].E();
   }
+  const M4Vec sumP(sx, sy, sz, se);
 
   // pz and E of forward protons/N*
-  const double pt1 = lts.pfinal[1].Pt();
-  const double pt2 = lts.pfinal[2].Pt();
-  const double m1  = lts.pfinal_orig[1].M();
-  const double m2  = lts.pfinal_orig[2].M();
+  // (pt enters only squared here, so Pt2 avoids the sqrt round-trip)
+  const double pt1_2 = lts.pfinal[1].Pt2();
+  const double pt2_2 = lts.pfinal[2].Pt2();
+  const double m1    = lts.pfinal_orig[1].M();
+  const double m2    = lts.pfinal_orig[2].M();
 
-  double p1z = gra::kinematics::SolvePz(m1, m2, pt1, pt2, sumP.Pz(), sumP.E(), lts.s);
+  double p1z = gra::kinematics::SolvePz2(m1, m2, pt1_2, pt2_2, sumP.Pz(), sumP.E(), lts.s);
   double p2z = -(sumP.Pz() + p1z);  // by momentum conservation
 
   // Enforce scattering direction +p -> +p, -p -> -p (VERY RARE POLYNOMIAL
-  // BRANCH FLIP)
-  if (p1z < 0 || p2z > 0) { return false; }
+  // BRANCH FLIP); non-short-circuit OR keeps this a single branch
+  if ((p1z < 0) | (p2z > 0)) [[unlikely]] { return false; }
 
-  lts.pfinal[1].SetPzE(p1z, msqrt(pow2(m1) + pow2(pt1) + pow2(p1z)));
-  lts.pfinal[2].SetPzE(p2z, msqrt(pow2(m2) + pow2(pt2) + pow2(p2z)));
+  lts.pfinal[1].SetPzE(p1z, msqrt(pow2(m1) + pt1_2 + pow2(p1z)));
+  lts.pfinal[2].SetPzE(p2z, msqrt(pow2(m2) + pt2_2 + pow2(p2z)));
   lts.pfinal[0] = sumP;
 
   // ------------------------------------------------------------------
-  // Now boost if asymmetric beams
+  // Now boost if asymmetric beams; one batch call over the contiguous
+  // pfinal slots shares the frame factors
   if (std::abs(beamsum.Pz()) > 1e-6) {
     constexpr int sign = 1;  // positive -> boost to the lab
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, lts.pfinal[1], sign);
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, lts.pfinal[2], sign);
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, lts.pfinal[0], sign);
-
-    for (std::size_t i = 0; i < Kf; ++i) {
-      kinematics::LorentzBoost(beamsum, lts.sqrt_s, lts.pfinal[i + offset], sign);
-    }
+    kinematics::LorentzBoostBatch(beamsum, lts.sqrt_s, lts.pfinal.data(), Kf + offset, sign);
   }
   // ------------------------------------------------------------------
 
   // Check Energy-Momentum
-  if (!gra::math::CheckEMC(beamsum - (lts.pfinal[1] + lts.pfinal[2] + lts.pfinal[0]))) {
+  if (!gra::math::CheckEMC(beamsum - (lts.pfinal[1] + lts.pfinal[2] + lts.pfinal[0]))) [[unlikely]] {
     return false;
   }
 
@@ -161,7 +256,7 @@ bool MContinuum::LoopKinematics(const std::vector<double> &p1p, const std::vecto
 }
 
 // Get weight
-double MContinuum::EventWeight(const std::vector<double> &randvec, AuxIntData &aux) {
+double MContinuum::EventWeight(std::span<const double> randvec, AuxIntData &aux) {
   double W = 0.0;
 
   // Kinematics
@@ -212,37 +307,26 @@ void MContinuum::PrintInit(bool silent) const {
       proton2 = "-----------F2-xxxxxxxx>";
     }
 
-    std::string pomeronloop = (SCREENING == true) ? "     **    " : "           ";
+    const std::string pomeronloop = (SCREENING == true) ? "     **    " : "           ";
+
+    // Print diagram; rows are streamed directly instead of buffered into
+    // intermediate string vectors
+    const auto printrow = [&](const char *row) {
+      std::cout << rang::fg::red << pomeronloop << rang::style::reset << row << std::endl;
+    };
 
-    std::vector<std::string> legs;
+    std::cout << proton1 << std::endl;
+    printrow("||         ");
     for (const auto &i : indices(lts.decaytree)) {
       char buff[250];
       snprintf(buff, sizeof(buff), "x---------> %d (%s) [Q=%s, J=%s]", lts.decaytree[i].p.pdg,
                lts.decaytree[i].p.name.c_str(),
                gra::aux::Charge3XtoString(lts.decaytree[i].p.chargeX3).c_str(),
                gra::aux::Spin2XtoString(lts.decaytree[i].p.spinX2).c_str());
-      std::string leg = buff;
-      legs.push_back(leg);
-    }
-
-    std::vector<std::string> feynmangraph;
-    feynmangraph.push_back("||         ");
-    for (const auto &i : indices(lts.decaytree)) {
-      feynmangraph.push_back(legs[i]);
-      if (i < lts.decaytree.size() - 1) feynmangraph.push_back("|          ");
-    }
-    feynmangraph.push_back("||         ");
-
-    // Print diagram
-    std::cout << proton1 << std::endl;
-    for (const auto &i : indices(feynmangraph)) {
-      if (SCREENING) {  // Put red
-        std::cout << rang::fg::red << pomeronloop << rang::style::reset;
-      } else {
-        std::cout << rang::fg::red << pomeronloop << rang::style::reset;
-      }
-      std::cout << feynmangraph[i] << std::endl;
+      printrow(buff);
+      if (i < lts.decaytree.size() - 1) { printrow("|          "); }
     }
+    printrow("||         ");
     std::cout << proton2 << std::endl;
     std::cout << std::endl;
 
@@ -273,16 +357,12 @@ void MContinuum::PrintInit(bool silent) const {
 }
 
 // (3*Nf-4)-dimensional phase space vector initialization
-bool MContinuum::BNRandomKin(unsigned int Nf, const std::vector<double> &randvec) {
+bool MContinuum::BNRandomKin(unsigned int Nf, std::span<const double> randvec) {
   const unsigned int Kf = Nf - 2;  // Central system multiplicity
 
-  // log-change of variables for pt
-  const double u1 =
-      std::log(gcuts.forward_pt_min + ZERO_EPS) +
-      (std::log(gcuts.forward_pt_max) - std::log(gcuts.forward_pt_min + ZERO_EPS)) * randvec[0];
-  const double u2 =
-      std::log(gcuts.forward_pt_min + ZERO_EPS) +
-      (std::log(gcuts.forward_pt_max) - std::log(gcuts.forward_pt_min + ZERO_EPS)) * randvec[1];
+  // log-change of variables for pt (endpoints folded in post_Constructor)
+  const double u1 = log_fwd_pt_min_ + log_fwd_pt_range_ * randvec[0];
+  const double u2 = log_fwd_pt_min_ + log_fwd_pt_range_ * randvec[1];
 
   const double pt1 = std::exp(u1);
   const double pt2 = std::exp(u2);
@@ -291,41 +371,46 @@ bool MContinuum::BNRandomKin(unsigned int Nf, const std::vector<double> &randvec
   const double       phi2   = 2.0 * gra::math::PI * randvec[3];
   const unsigned int offset = 4;  // 4 variables above
 
-  // Decay product masses
+  // Decay product masses (skipped when all legs are zero-width: the
+  // delta-function values are preset in post_Constructor and the
+  // sampling draws nothing from the RNG in that case anyway)
   // ==============================================================
-  for (const auto &i : indices(lts.decaytree)) {
-    GetOffShellMass(lts.decaytree[i], lts.decaytree[i].m_offshell);
+  if (!zero_width_legs_) {
+    for (const auto &i : indices(lts.decaytree)) {
+      GetOffShellMass(lts.decaytree[i], lts.decaytree[i].m_offshell);
+    }
   }
   // ==============================================================
 
-  // Intermediate kt
-  std::vector<double> kt(Kf - 1, 0.0);  // Kf-1
-  size_t              ind = offset;
+  // Intermediate kt (member scratch: no per-event heap allocation)
+  std::vector<double> &kt = ktbuf_;
+  kt.assign(Kf - 1, 0.0);  // Kf-1
+  size_t ind = offset;
   for (const auto &i : indices(kt)) {
-    kt[i] = gcuts.kt_min + (gcuts.kt_max - gcuts.kt_min) * randvec[ind];
+    kt[i] = gcuts.kt_min + kt_span_ * randvec[ind];
     ++ind;
   }
 
   // Intermediate phi
-  std::vector<double> phi(Kf - 1, 0.0);  // Kf-1
+  std::vector<double> &phi = phibuf_;
+  phi.assign(Kf - 1, 0.0);  // Kf-1
   for (const auto &i : indices(phi)) {
     phi[i] = 2.0 * PI * randvec[ind];
     ++ind;
   }
 
   // Final state rapidity
-  std::vector<double> y(Kf, 0.0);  // Kf
+  std::vector<double> &y = ybuf_;
+  y.assign(Kf, 0.0);  // Kf
   for (const auto &i : indices(y)) {
-    y[i] = gcuts.rap_min + (gcuts.rap_max - gcuts.rap_min) * randvec[ind];
+    y[i] = gcuts.rap_min + rap_span_ * randvec[ind];
     ++ind;
   }
 
-  // Forward N* system masses
-  std::vector<double> mvec;
-  std::vector<double> rvec;
-  if (EXCITATION == 1) { rvec = {randvec[ind]}; }
-  if (EXCITATION == 2) { rvec = {randvec[ind], randvec[ind + 1]}; }
-  SampleForwardMasses(mvec, rvec);
+  // Forward N* system masses (member scratch; the tail of randvec holds
+  // the excitation variables, so no intermediate vector is needed)
+  std::vector<double> &mvec = mbuf_;
+  SampleForwardMasses(mvec, randvec.subspan(ind));
 
   return BNBuildKin(Nf, pt1, pt2, phi1, phi2, kt, phi, y, mvec[0], mvec[1]);
 }
@@ -347,77 +432,89 @@ bool MContinuum::BNBuildKin(unsigned int Nf, double pt1, double pt2, double phi1
   }
 
   // Forward protons px,py
-  M4Vec p1(pt1 * std::cos(phi1), pt1 * std::sin(phi1), 0, 0);
-  M4Vec p2(pt2 * std::cos(phi2), pt2 * std::sin(phi2), 0, 0);
+  double s1 = 0.0, c1 = 0.0, s2 = 0.0, c2 = 0.0;
+  gra::math::msincos(phi1, s1, c1);
+  gra::math::msincos(phi2, s2, c2);
+  M4Vec p1(pt1 * c1, pt1 * s1, 0, 0);
+  M4Vec p2(pt2 * c2, pt2 * s2, 0, 0);
 
   // Auxialary "difference momentum" q0 = p0 - p1 ...
+  // SoA component stores; one fused sincos per intermediate leg
   pkt_.resize(Kf - 1);
-  for (const auto &i : indices(pkt_)) {
-    pkt_[i] = M4Vec(kt[i] * std::cos(phi[i]), kt[i] * std::sin(phi[i]), 0, 0);
+  kt_prod_ = 1.0;
+  for (std::size_t i = 0; i < Kf - 1; ++i) {
+    double s = 0.0, c = 0.0;
+    gra::math::msincos(phi[i], s, c);
+    pkt_.px[i] = kt[i] * c;
+    pkt_.py[i] = kt[i] * s;
+    kt_prod_ *= kt[i];
   }
 
-  // Apply linear system to get p
-  std::vector<M4Vec> p(Kf, M4Vec(0, 0, 0, 0));
-  BLinearSystem(p, pkt_, p1, p2);
+  // Apply linear system; px,py are written straight into the pfinal
+  // slots (no intermediate vector roundtrip)
+  const unsigned int offset = 3;
+  BLinearSystem(&lts.pfinal[offset], Kf, pkt_, p1, p2);
 
   // Set pz and E for central final states
-  M4Vec sumP(0, 0, 0, 0);
-  for (const auto &i : indices(p)) {
+  // (one exp per particle instead of separate sinh and cosh calls);
+  // the system sum is accumulated in scalar registers in the same sweep
+  double sx = 0.0, sy = 0.0, sz = 0.0, se = 0.0;
+  for (unsigned int i = 0; i < Kf; ++i) {
+    M4Vec &      pc = lts.pfinal[i + offset];
     const double m  = lts.decaytree[i].m_offshell;  // Note offshell!
-    const double mt = msqrt(pow2(m) + p[i].Pt2());
-    p[i].SetPzE(mt * std::sinh(y[i]), mt * std::cosh(y[i]));
-    sumP += p[i];
+    const double mt = msqrt(pow2(m) + pc.Pt2());
+    double       sh = 0.0, ch = 0.0;
+    gra::math::msinhcosh(y[i], sh, ch);
+    pc.SetPzE(mt * sh, mt * ch);
+    sx += pc.Px();
+    sy += pc.Py();
+    sz += pc.Pz();
+    se += pc.E();
   }
+  M4Vec sumP(sx, sy, sz, se);
 
-  // Check crude energy overflow
-  if (sumP.E() > lts.sqrt_s) { return false; }
-
-  double p1z = gra::kinematics::SolvePz(m1, m2, pt1, pt2, sumP.Pz(), sumP.E(), lts.s);
-  double p2z = -(sumP.Pz() + p1z);  // by momentum conservation
+  // SolvePz is safe to run also on energy-overflow input (a NaN root fails
+  // every comparison below), so the cheap rejections fuse into one test
+  const double p1z = gra::kinematics::SolvePz(m1, m2, pt1, pt2, sumP.Pz(), sumP.E(), lts.s);
+  const double p2z = -(sumP.Pz() + p1z);  // by momentum conservation
 
-  // Enforce scattering direction +p -> +p, -p -> -p (VERY RARE POLYNOMIAL
-  // BRANCH FLIP)
-  if (p1z < 0 || p2z > 0) { return false; }
+  // Crude energy overflow | scattering direction +p -> +p, -p -> -p
+  // (VERY RARE POLYNOMIAL BRANCH FLIP)
+  const bool reject = (sumP.E() > lts.sqrt_s) | (p1z < 0) | (p2z > 0);
+  if (reject) [[unlikely]] { return false; }
 
   // pz and E of protons/N*
-  p1.SetPzE(p1z, msqrt(pow2(m1) + pow2(pt1) + pow2(p1z)));
-  p2.SetPzE(p2z, msqrt(pow2(m2) + pow2(pt2) + pow2(p2z)));
+  p1.SetPzE(p1z, OnShellEnergy(m1, pt1, p1z));
+  p2.SetPzE(p2z, OnShellEnergy(m2, pt2, p2z));
+
+  // First branch kinematics
+  lts.pfinal[1] = p1;  // Forward systems
+  lts.pfinal[2] = p2;
+  lts.pfinal[0] = sumP;  // Central system
 
   // ------------------------------------------------------------------
-  // Now boost if asymmetric beams
+  // Now boost if asymmetric beams; the final states sit contiguously in
+  // pfinal, so a single batch call shares the frame factors over all
   if (std::abs(beamsum.Pz()) > 1e-6) {
     constexpr int sign = 1;  // positive -> boost to the lab
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, p1, sign);
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, p2, sign);
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, sumP, sign);
-
-    for (const auto &i : indices(p)) { kinematics::LorentzBoost(beamsum, lts.sqrt_s, p[i], sign); }
+    kinematics::LorentzBoostBatch(beamsum, lts.sqrt_s, lts.pfinal.data(), Kf + offset, sign);
   }
   // ------------------------------------------------------------------
 
-  // First branch kinematics
-  lts.pfinal[1] = p1;  // Forward systems
-  lts.pfinal[2] = p2;
-  lts.pfinal[0] = sumP;  // Central system
-
-  double             sumM   = 0;
-  const unsigned int offset = 3;
-  for (const auto &i : indices(p)) {
-    lts.decaytree[i].p4    = p[i];
-    lts.pfinal[i + offset] = p[i];
-    sumM += p[i].M();
+  double sumM = 0;
+  for (const auto &i : indices(lts.decaytree)) {
+    lts.decaytree[i].p4 = lts.pfinal[i + offset];
+    sumM += lts.pfinal[i + offset].M();
   }
 
   // -------------------------------------------------------------------
   // Kinematic checks
 
-  // Check we are above mass threshold
-  if (sumP.M() < sumM) { return false; }
-
-  // Total 4-momentum conservation
-  if (!gra::math::CheckEMC(beamsum - (lts.pfinal[1] + lts.pfinal[2] + lts.pfinal[0]))) {
-    return false;
-  }
+  // Mass threshold | total 4-momentum conservation (accumulated to one test)
+  const bool kinreject =
+      (lts.pfinal[0].M() < sumM) |
+      (!gra::math::CheckEMC(beamsum - (lts.pfinal[1] + lts.pfinal[2] + lts.pfinal[0])));
+  if (kinreject) [[unlikely]] { return false; }
 
   // -------------------------------------------------------------------
 
@@ -435,7 +532,7 @@ bool MContinuum::BNBuildKin(unsigned int Nf, double pt1, double pt2, double phi1
 }
 
 // Construct the linear system
-void MContinuum::BLinearSystem(std::vector<M4Vec> &p, const std::vector<M4Vec> &q, const M4Vec &p1f,
+void MContinuum::BLinearSystem(M4Vec *p, unsigned int Kf, const M4VecSoA &q, const M4Vec &p1f,
                                const M4Vec &p2f) const {
   /*
 
@@ -477,75 +574,53 @@ void MContinuum::BLinearSystem(std::vector<M4Vec> &p, const std::vector<M4Vec> &
   -------------------------------
   */
 
-  static const std::vector<std::vector<std::vector<double>>> A = {
-      {{1.0 / 2.0, 0.0}, {0.0, 1.0 / 2.0}},
-
-      {{2.0 / 3.0, 0.0, -1.0 / 3.0},
-       {1.0 / 6.0, 1.0 / 2.0, -1.0 / 3.0},
-       {-1.0 / 3.0, 0.0, 2.0 / 3.0}},
-
-      {{7.0 / 8.0, 1.0 / 8.0, -1.0 / 2.0, -1.0 / 4.0},
-       {3.0 / 8.0, 5.0 / 8.0, -1.0 / 2.0, -1.0 / 4.0},
-       {-1.0 / 8.0, 1.0 / 8.0, 1.0 / 2.0, -1.0 / 4.0},
-       {-5.0 / 8.0, -3.0 / 8.0, 1.0 / 2.0, 3.0 / 4.0}},
-
-      {{11.0 / 10.0, 3.0 / 10.0, -3.0 / 5.0, -2.0 / 5.0, -1.0 / 5.0},
-       {3.0 / 5.0, 4.0 / 5.0, -3.0 / 5.0, -2.0 / 5.0, -1.0 / 5.0},
-       {1.0 / 10.0, 3.0 / 10.0, 2.0 / 5.0, -2.0 / 5.0, -1.0 / 5.0},
-       {-2.0 / 5.0, -1.0 / 5.0, 2.0 / 5.0, 3.0 / 5.0, -1.0 / 5.0},
-       {-9.0 / 10.0, -7.0 / 10.0, 2.0 / 5.0, 3.0 / 5.0, 4.0 / 5.0}},
-
-      {{4.0 / 3.0, 1.0 / 2.0, -2.0 / 3.0, -1.0 / 2.0, -1.0 / 3.0, -1.0 / 6.0},
-       {5.0 / 6.0, 1.0 / 1.0, -2.0 / 3.0, -1.0 / 2.0, -1.0 / 3.0, -1.0 / 6.0},
-       {1.0 / 3.0, 1.0 / 2.0, 1.0 / 3.0, -1.0 / 2.0, -1.0 / 3.0, -1.0 / 6.0},
-       {-1.0 / 6.0, 0.0, 1.0 / 3.0, 1.0 / 2.0, -1.0 / 3.0, -1.0 / 6.0},
-       {-2.0 / 3.0, -1.0 / 2.0, 1.0 / 3.0, 1.0 / 2.0, 2.0 / 3.0, -1.0 / 6.0},
-       {-7.0 / 6.0, -1.0 / 1.0, 1.0 / 3.0, 1.0 / 2.0, 2.0 / 3.0, 5.0 / 6.0}},
-
-      {{11.0 / 7.0, 5.0 / 7.0, -5.0 / 7.0, -4.0 / 7.0, -3.0 / 7.0, -2.0 / 7.0, -1.0 / 7.0},
-       {15.0 / 14.0, 17.0 / 14.0, -5.0 / 7.0, -4.0 / 7.0, -3.0 / 7.0, -2.0 / 7.0, -1.0 / 7.0},
-       {4.0 / 7.0, 5.0 / 7.0, 2.0 / 7.0, -4.0 / 7.0, -3.0 / 7.0, -2.0 / 7.0, -1.0 / 7.0},
-       {1.0 / 14.0, 3.0 / 14.0, 2.0 / 7.0, 3.0 / 7.0, -3.0 / 7.0, -2.0 / 7.0, -1.0 / 7.0},
-       {-3.0 / 7.0, -2.0 / 7.0, 2.0 / 7.0, 3.0 / 7.0, 4.0 / 7.0, -2.0 / 7.0, -1.0 / 7.0},
-       {-13.0 / 14.0, -11.0 / 14.0, 2.0 / 7.0, 3.0 / 7.0, 4.0 / 7.0, 5.0 / 7.0, -1.0 / 7.0},
-       {-10.0 / 7.0, -9.0 / 7.0, 2.0 / 7.0, 3.0 / 7.0, 4.0 / 7.0, 5.0 / 7.0, 6.0 / 7.0}},
-
-      {{29.0 / 16.0, 15.0 / 16.0, -3.0 / 4.0, -5.0 / 8.0, -1.0 / 2.0, -3.0 / 8.0, -1.0 / 4.0,
-        -1.0 / 8.0},
-       {21.0 / 16.0, 23.0 / 16.0, -3.0 / 4.0, -5.0 / 8.0, -1.0 / 2.0, -3.0 / 8.0, -1.0 / 4.0,
-        -1.0 / 8.0},
-       {13.0 / 16.0, 15.0 / 16.0, 1.0 / 4.0, -5.0 / 8.0, -1.0 / 2.0, -3.0 / 8.0, -1.0 / 4.0,
-        -1.0 / 8.0},
-       {5.0 / 16.0, 7.0 / 16.0, 1.0 / 4.0, 3.0 / 8.0, -1.0 / 2.0, -3.0 / 8.0, -1.0 / 4.0,
-        -1.0 / 8.0},
-       {-3.0 / 16.0, -1.0 / 16.0, 1.0 / 4.0, 3.0 / 8.0, 1.0 / 2.0, -3.0 / 8.0, -1.0 / 4.0,
-        -1.0 / 8.0},
-       {-11.0 / 16.0, -9.0 / 16.0, 1.0 / 4.0, 3.0 / 8.0, 1.0 / 2.0, 5.0 / 8.0, -1.0 / 4.0,
-        -1.0 / 8.0},
-       {-19.0 / 16.0, -17.0 / 16.0, 1.0 / 4.0, 3.0 / 8.0, 1.0 / 2.0, 5.0 / 8.0, 3.0 / 4.0,
-        -1.0 / 8.0},
-       {-27.0 / 16.0, -25.0 / 16.0, 1.0 / 4.0, 3.0 / 8.0, 1.0 / 2.0, 5.0 / 8.0, 3.0 / 4.0,
-        7.0 / 8.0}}};
+  // Dispatch to a Kf-specialized kernel; Kf is fixed per run but the value
+  // is only known at runtime, so a switch bridges it to a compile-time
+  // trip count (full unroll + matrix constants folded in)
+  switch (Kf) {
+    case 2: return BLinearSystemT<2>(p, q, p1f, p2f);
+    case 3: return BLinearSystemT<3>(p, q, p1f, p2f);
+    case 4: return BLinearSystemT<4>(p, q, p1f, p2f);
+    case 5: return BLinearSystemT<5>(p, q, p1f, p2f);
+    case 6: return BLinearSystemT<6>(p, q, p1f, p2f);
+    case 7: return BLinearSystemT<7>(p, q, p1f, p2f);
+    case 8: return BLinearSystemT<8>(p, q, p1f, p2f);
+    default:
+      throw std::invalid_argument("MContinuum::BLinearSystem: Kf = " + std::to_string(Kf) +
+                                  " out of range [2," + std::to_string(BLS_KFMAX) + "]");
+  }
+}
+
+template <unsigned int KF>
+void MContinuum::BLinearSystemT(M4Vec *p, const M4VecSoA &q, const M4Vec &p1f,
+                                const M4Vec &p2f) const {
+  // Only the px,py components enter the system: q carries pure transverse
+  // kicks and the pz,E of the output are rebuilt from rapidity right after
+  // the call, so solve the two components over contiguous stack arrays
+  // instead of full M4Vec arithmetic
+  const double wx = p1f.Px() + p2f.Px();
+  const double wy = p1f.Py() + p2f.Py();
 
   // Construct vector b
-  const unsigned int Kf = p.size();  // Number of central system particles
-  std::vector<M4Vec> b(Kf);
-  const M4Vec        p1p2sum = p1f + p2f;
-
-  for (const auto &i : indices(b)) {
-    if (i == 0) {
-      b[i] = q[0] - p1p2sum;
-    } else {
-      b[i] = q[i - 1] * (-1.0) - p1p2sum;
-    }
+  double bx[KF];
+  double by[KF];
+  bx[0] = q.px[0] - wx;
+  by[0] = q.py[0] - wy;
+  for (unsigned int i = 1; i < KF; ++i) {
+    bx[i] = -q.px[i - 1] - wx;
+    by[i] = -q.py[i - 1] - wy;
   }
 
   // Apply linear system p = Ab to get px,py components for each p[i]
-  const unsigned int index = Kf - 2;  // -2 because of C++
-  for (const auto &i : indices(p)) {
-    for (const auto &j : indices(b)) {
-      p[i] += b[j] * A[index][i][j];  // notice plus
+  constexpr const double(*A)[BLS_KFMAX] = BLS_A[KF - 2];
+  for (unsigned int i = 0; i < KF; ++i) {
+    double px = 0.0;
+    double py = 0.0;
+    for (unsigned int j = 0; j < KF; ++j) {
+      px += A[i][j] * bx[j];
+      py += A[i][j] * by[j];
     }
+    p[i].SetPxPy(px, py);
   }
 }
 
@@ -617,22 +692,9 @@ fprintf('};\n');
 // For reference, Nf = 4 special case in:
 // [REFERENCE: Lebiedowicz, Szczurek, arxiv.org/abs/0912.0190]
 double MContinuum::BNIntegralVolume() const {
-  // Number of central states
-  const unsigned int Kf = lts.decaytree.size();
-
-  // Forward leg integration
-  const double forward_volume = ForwardVolume();
-
-  // Intermediate kt volume
-  double KT_vol = std::pow(gcuts.kt_max - gcuts.kt_min, Kf - 1);
-
-  // phi angle volume
-  KT_vol *= std::pow(2.0 * PI, Kf - 1);
-
-  // rapidity volume
-  KT_vol *= std::pow(gcuts.rap_max - gcuts.rap_min, Kf);
-
-  return KT_vol * forward_volume;
+  // [kt] x [phi] x [y] volume folded once in post_Constructor;
+  // only the forward leg integration remains per event
+  return kt_volume_ * ForwardVolume();
 }
 
 
@@ -641,16 +703,13 @@ double MContinuum::BNPhaseSpaceWeight() const {
   const double J = 1.0 / std::abs(lts.pfinal[1].Pz() / lts.pfinal[1].E() -
                                   lts.pfinal[2].Pz() / lts.pfinal[2].E());
 
-  // Number of final states
-  const unsigned int Nf = lts.decaytree.size() + 2;
-
   // Intermediate "difference"
-  // kt factors from \prod_i d^2 k_i = \prod_i dphi_i kt_i dkt_i
-  double PROD = 1.0;
-  for (const auto &i : indices(pkt_)) { PROD *= pkt_[i].Pt(); }
+  // kt factors from \prod_i d^2 k_i = \prod_i dphi_i kt_i dkt_i;
+  // the product of sampled |kt_i| is cached when pkt_ is filled
+  const double PROD = kt_prod_;
 
-  const double factor = (1.0 / std::pow(2, 2 * (Nf - 2))) * (1.0 / std::pow(2.0 * PI, 3 * Nf - 4)) *
-                        (lts.pfinal[1].Pt() / (2.0 * lts.pfinal[1].E())) *
+  // Normalization 1 / (2^{2(Nf-2)} (2pi)^{3Nf-4}) folded in post_Constructor
+  const double factor = ps_norm_ * (lts.pfinal[1].Pt() / (2.0 * lts.pfinal[1].E())) *
                         (lts.pfinal[2].Pt() / (2.0 * lts.pfinal[2].E())) * J * PROD;
   return factor;
 }
@@ -311,6 +311,17 @@ double MDurham::DQtloop(gra::LORENTZSCALAR &                           lts,
   // Spin-Parity
   std::vector<std::complex<double>> JzP(4, 0.0);
 
+  // Grid direction cosines (phi nodes shared by every |q_t| row) and
+  // re-used loop vectors -- no per-node trigonometry or heap allocation
+  // inside the 2D loop
+  std::vector<double> cphi(Param.N_phi + 1, 0.0);
+  std::vector<double> sphi(Param.N_phi + 1, 0.0);
+  for (std::size_t j = 0; j < Param.N_phi + 1; ++j) {
+    gra::math::msincos(j * Param.phi_STEP, sphi[j], cphi[j]);
+  }
+  std::vector<double> q1(2, 0.0);
+  std::vector<double> q2(2, 0.0);
+
   // 2D-loop integral
   //
   // \int d^2 \vec{qt} [...] = \int dphi \int dqt qt [...]
@@ -323,15 +334,16 @@ double MDurham::DQtloop(gra::LORENTZSCALAR &                           lts,
 
     // Linearly discretized phi in [0,2pi), N+1!
     for (std::size_t j = 0; j < Param.N_phi + 1; ++j) {
-      const double qphi = j * Param.phi_STEP;
-
       // --------------------------------------------------------------------------
       // Loop vector
-      const std::vector<double> qt_ = {qt * std::cos(qphi), qt * std::sin(qphi)};
+      const double qx = qt * cphi[j];
+      const double qy = qt * sphi[j];
 
       // Fusing gluon pt-vectors
-      const std::vector<double> q1 = {qt_[0] - pt1[0], qt_[1] - pt1[1]};
-      const std::vector<double> q2 = {qt_[0] + pt2[0], qt_[1] + pt2[1]};
+      q1[0] = qx - pt1[0];
+      q1[1] = qy - pt1[1];
+      q2[0] = qx + pt2[0];
+      q2[1] = qy + pt2[1];
 
       const double q1_2 = math::vpow2(q1);
       const double q2_2 = math::vpow2(q2);
@@ -30,6 +30,7 @@ using gra::aux::indices;
 using gra::math::abs2;
 using gra::math::CheckEMC;
 using gra::math::msqrt;
+using gra::math::OnShellEnergy;
 using gra::math::PI;
 using gra::math::pow2;
 using gra::math::pow3;
@@ -50,9 +51,6 @@ MFactorized::MFactorized(std::string process, const std::vector<aux::OneCMD> &sy
   InitHistograms();
   SetProcess(process, syntax);
 
-  // Init final states
-  M4Vec zerovec(0, 0, 0, 0);
-  for (std::size_t i = 0; i < 10; ++i) { lts.pfinal.push_back(zerovec); }
   std::cout << "MFactorized:: [Constructor done]" << std::endl;
 }
 
@@ -75,6 +73,45 @@ void MFactorized::post_Constructor() {
 
   if (EXCITATION == 1) { ProcPtr.LIPSDIM += 1; }
   if (EXCITATION == 2) { ProcPtr.LIPSDIM += 2; }
+
+  // Active final state slots: central system + 2 forward legs + decay legs
+  lts.pfinal_n = lts.decaytree.size() + 3;
+
+  // Fold the sampling window endpoints (fixed generation cuts) once
+  log_fwd_pt_min_   = std::log(gcuts.forward_pt_min + ZERO_EPS);
+  log_fwd_pt_range_ = std::log(gcuts.forward_pt_max) - log_fwd_pt_min_;
+  rap_span_         = gcuts.Y_max - gcuts.Y_min;
+
+  // Weight normalization: symmetry factor, unit conversion and Moller flux
+  // are all fixed after setup
+  w_norm_ = (1.0 / S_factor) * GeV2barn / MollerFlux();
+
+  // Stable (zero-width) first-level legs have delta-function offshell
+  // masses: preset them once and collapse the per-event mass trial loop
+  zero_width_legs_ = true;
+  for (const auto &i : indices(lts.decaytree)) {
+    if (lts.decaytree[i].p.width >= 1e-40) {
+      zero_width_legs_ = false;
+      break;
+    }
+  }
+  if (zero_width_legs_) {
+    legs_m_sum_ = 0.0;
+    for (const auto &i : indices(lts.decaytree)) {
+      lts.decaytree[i].m_offshell = lts.decaytree[i].p.mass;
+      legs_m_sum_ += lts.decaytree[i].p.mass;
+    }
+  }
+
+  // Resolve the central system phase space generator by the (fixed) decay
+  // topology instead of branching per event in B51BuildKin
+  if (lts.decaytree.size() == 2) {
+    psgen_ = &MFactorized::PS2;
+  } else if (lts.decaytree.size() == 3) {
+    psgen_ = &MFactorized::PS3;
+  } else if (lts.decaytree.size() > 3) {
+    psgen_ = &MFactorized::PSN;
+  }
 }
 
 // Update kinematics (screening kT loop calls this)
@@ -103,43 +140,48 @@ bool MFactorized::LoopKinematics(const std::vector<double> &p1p, const std::vect
   lts.pfinal[0].SetPxPy(-(lts.pfinal[1].Px() + lts.pfinal[2].Px()),
                         -(lts.pfinal[1].Py() + lts.pfinal[2].Py()));
 
-  // Central system pz and E
+  // Central system pz and E (sinh and cosh share one exp)
   const double mtX = msqrt(pow2(mX) + lts.pfinal[0].Pt2());
-  lts.pfinal[0].SetPzE(mtX * std::sinh(yX), mtX * std::cosh(yX));
+  double       shy = 0.0, chy = 0.0;
+  gra::math::msinhcosh(yX, shy, chy);
+  lts.pfinal[0].SetPzE(mtX * shy, mtX * chy);
 
-  // Energy overflow
-  if (lts.pfinal[0].E() > (lts.sqrt_s - (m1 + m2))) { return false; }
-
-  double p1z =
+  // SolvePz is safe to run also on energy-overflow input (a NaN root is
+  // caught below), so the cheap rejections fuse into one accumulated test
+  const double p1z =
       gra::kinematics::SolvePz(m1, m2, pt1, pt2, lts.pfinal[0].Pz(), lts.pfinal[0].E(), lts.s);
-  double p2z = -(lts.pfinal[0].Pz() + p1z);  // by momentum conservation
-  if (std::isnan(p1z)) { return false; }
+  const double p2z = -(lts.pfinal[0].Pz() + p1z);  // by momentum conservation
 
-  // Enforce scattering direction +p -> +p, -p -> -p (VERY RARE POLYNOMIAL
-  // BRANCH FLIP)
-  if (p1z < 0 || p2z > 0) { return false; }
+  // Energy overflow | NaN root | scattering direction +p -> +p, -p -> -p
+  // (VERY RARE POLYNOMIAL BRANCH FLIP)
+  const bool reject = (lts.pfinal[0].E() > (lts.sqrt_s - (m1 + m2))) | std::isnan(p1z) |
+                      (p1z < 0) | (p2z > 0);
+  if (reject) { return false; }
 
   // Pz and E of protons/N*
-  lts.pfinal[1].SetPzE(p1z, msqrt(pow2(m1) + pow2(pt1) + pow2(p1z)));
-  lts.pfinal[2].SetPzE(p2z, msqrt(pow2(m2) + pow2(pt2) + pow2(p2z)));
+  lts.pfinal[1].SetPzE(p1z, OnShellEnergy(m1, pt1, p1z));
+  lts.pfinal[2].SetPzE(p2z, OnShellEnergy(m2, pt2, p2z));
 
   // ------------------------------------------------------------------
   // Now boost if asymmetric beams
   if (std::abs(beamsum.Pz()) > 1e-6) {
     constexpr int sign = 1;  // positive -> boost to the lab
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, lts.pfinal[1], sign);
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, lts.pfinal[2], sign);
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, lts.pfinal[0], sign);
+    kinematics::LorentzBoostBatch(beamsum, lts.sqrt_s, lts.pfinal.data(), 3, sign);
   }
   // ------------------------------------------------------------------
 
-  if (!CheckEMC(beamsum - (lts.pfinal[1] + lts.pfinal[2] + lts.pfinal[0]))) { return false; }
+  // Conservation only breaks through rounding at this point
+  if (!CheckEMC(beamsum - (lts.pfinal[1] + lts.pfinal[2] + lts.pfinal[0]))) [[unlikely]] {
+    return false;
+  }
 
-  return GetLorentzScalars(Nf);
+  // Central decay products are untouched by the screening loop, so their
+  // pair invariants are reused from the full kinematics pass
+  return GetLorentzScalars(Nf, true);
 }
 
 // Return Monte Carlo integrand weight
-double MFactorized::EventWeight(const std::vector<double> &randvec, AuxIntData &aux) {
+double MFactorized::EventWeight(std::span<const double> randvec, AuxIntData &aux) {
   double W = 0.0;
 
   // Kinematics and cuts
@@ -170,8 +212,7 @@ double MFactorized::EventWeight(const std::vector<double> &randvec, AuxIntData &
     }
 
     // ** EVENT WEIGHT **
-    W = C_space * (1.0 / S_factor) * B51PhaseSpaceWeight() * B51IntegralVolume() * MatESQ *
-        GeV2barn / MollerFlux();
+    W = C_space * w_norm_ * B51PhaseSpaceWeight() * B51IntegralVolume() * MatESQ;
   }
 
   aux.amplitude_ok = CheckInfNan(W);
@@ -242,67 +283,73 @@ void MFactorized::PrintInit(bool silent) const {
 }
 
 // 5+1-dimensional phase space vector initialization
-bool MFactorized::B51RandomKin(const std::vector<double> &randvec) {
-  // log-change of variables for pt
-  const double u1 =
-      std::log(gcuts.forward_pt_min + ZERO_EPS) +
-      (std::log(gcuts.forward_pt_max) - std::log(gcuts.forward_pt_min + ZERO_EPS)) * randvec[0];
-  const double u2 =
-      std::log(gcuts.forward_pt_min + ZERO_EPS) +
-      (std::log(gcuts.forward_pt_max) - std::log(gcuts.forward_pt_min + ZERO_EPS)) * randvec[1];
+bool MFactorized::B51RandomKin(std::span<const double> randvec) {
+  // log-change of variables for pt (endpoints folded in post_Constructor)
+  const double u1 = log_fwd_pt_min_ + log_fwd_pt_range_ * randvec[0];
+  const double u2 = log_fwd_pt_min_ + log_fwd_pt_range_ * randvec[1];
 
   const double pt1 = std::exp(u1);
   const double pt2 = std::exp(u2);
 
   const double phi1 = 2.0 * gra::math::PI * randvec[2];
   const double phi2 = 2.0 * gra::math::PI * randvec[3];
-  const double yX   = gcuts.Y_min + (gcuts.Y_max - gcuts.Y_min) * randvec[4];
-
-  // Pick daughter masses, can fail due to off-shelliness, then
-  // retry
-  unsigned int       trials   = 0;
-  const unsigned int MAXTRIAL = 1e7;
-  
-  std::vector<std::size_t> ind(lts.decaytree.size());
-  std::iota(ind.begin(), ind.end(), 0); // Running indices    
-  
-  while (true) {
-    double M_sum = 0.0;
-
-    // ==============================================================
-    // Randomize index order (avoid order bias in near threshold off-shell decays)
-    std::shuffle(ind.begin(), ind.end(), random.get_generator());
-
-    for (const auto &i : ind) {
-      GetOffShellMass(lts.decaytree[i], lts.decaytree[i].m_offshell);
-      M_sum += lts.decaytree[i].m_offshell;
+  const double yX   = gcuts.Y_min + rap_span_ * randvec[4];
+
+  // Pick daughter masses, can fail due to off-shelliness, then retry.
+  // The absolute upper bound and its generator cut do not depend on the
+  // drawn masses, so they sit outside the trial loop
+  const double MARGIN = 1e-4;  // GeV
+  M_MAX               = std::min(lts.sqrt_s - (lts.pbeam1.M() + lts.pbeam2.M()), gcuts.M_max);
+
+  if (zero_width_legs_) {
+    // Fixed leg masses (preset in post_Constructor): the window is decided
+    // once, there is nothing to retry
+    M_MIN = std::max(legs_m_sum_ + MARGIN, gcuts.M_min);
+    if (M_MIN >= M_MAX) {
+      throw std::invalid_argument(
+          "MFactorized::B51RandomKin: Empty mass window. Check the "
+          "decaymode and cuts!");
     }
-    // ==============================================================
+  } else {
+    const unsigned int MAXTRIAL = 1e7;
 
-    // Apply absolute boundary conditions first
-    const double MARGIN = 1e-4;  // GeV
-    M_MIN               = M_sum + MARGIN;
-    M_MAX               = lts.sqrt_s - (lts.pbeam1.M() + lts.pbeam2.M());
+    std::vector<std::size_t> &ind = indbuf_;
+    ind.resize(lts.decaytree.size());
+    std::iota(ind.begin(), ind.end(), 0);  // Running indices
 
-    // Apply generator cuts
-    M_MIN = std::max(M_MIN, gcuts.M_min);
-    M_MAX = std::min(M_MAX, gcuts.M_max);
+    // Bounded loop so the retry cap is visible up front
+    for (unsigned int trials = 0; true; ++trials) {
+      double M_sum = 0.0;
 
-    if (M_MIN < M_MAX) { break; }
-    ++trials;
-    if (trials > MAXTRIAL) {
-      throw std::invalid_argument(
-          "MFactorized::B51RandomKin: Infinite loop in kinematics. Check the "
-          "decaymode and cuts!");
+      // ==============================================================
+      // Randomize index order (avoid order bias in near threshold off-shell decays)
+      std::shuffle(ind.begin(), ind.end(), random.get_generator());
+
+      for (const auto &i : ind) {
+        GetOffShellMass(lts.decaytree[i], lts.decaytree[i].m_offshell);
+        M_sum += lts.decaytree[i].m_offshell;
+      }
+      // ==============================================================
+
+      // Apply absolute boundary conditions and generator cuts
+      M_MIN = std::max(M_sum + MARGIN, gcuts.M_min);
+
+      if (M_MIN < M_MAX) { break; }
+      if (trials >= MAXTRIAL) {
+        throw std::invalid_argument(
+            "MFactorized::B51RandomKin: Infinite loop in kinematics. Check the "
+            "decaymode and cuts!");
+      }
     }
-  };
+  }
 
   // Sample mass squared
   const double m2X = pow2(M_MIN) + (pow2(M_MAX) - pow2(M_MIN)) * randvec[5];
 
-  // Forward N* system masses
-  std::vector<double> mvec;
-  std::vector<double> rvec;
+  // Forward N* system masses (member scratch keeps its capacity across events)
+  std::vector<double> &mvec = mbuf_;
+  std::vector<double> &rvec = rbuf_;
+  rvec.clear();
   if (EXCITATION == 1) { rvec = {randvec[6]}; }
   if (EXCITATION == 2) { rvec = {randvec[6], randvec[7]}; }
   SampleForwardMasses(mvec, rvec);
@@ -315,61 +362,70 @@ bool MFactorized::B51BuildKin(double pt1, double pt2, double phi1, double phi2,
                               double m2X, double m1, double m2) {
   const M4Vec beamsum = lts.pbeam1 + lts.pbeam2;
 
-  // Final state 4-momenta, set px,py first
-  M4Vec p1(pt1 * std::cos(phi1), pt1 * std::sin(phi1), 0, 0);
-  M4Vec p2(pt2 * std::cos(phi2), pt2 * std::sin(phi2), 0, 0);
+  // Final state 4-momenta, set px,py first (sin and cos evaluated
+  // together so the compiler can emit one sincos call per angle)
+  double s1 = 0.0, c1 = 0.0, s2 = 0.0, c2 = 0.0;
+  gra::math::msincos(phi1, s1, c1);
+  gra::math::msincos(phi2, s2, c2);
+  M4Vec p1(pt1 * c1, pt1 * s1, 0, 0);
+  M4Vec p2(pt2 * c2, pt2 * s2, 0, 0);
   M4Vec pX(-(p1.Px() + p2.Px()), -(p1.Py() + p2.Py()), 0, 0);
 
-  // Central system pz and E
+  // Central system pz and E (sinh and cosh share one exp)
   const double mtX = msqrt(m2X + pX.Pt2());
-  pX.SetPzE(mtX * std::sinh(yX), mtX * std::cosh(yX));
+  double       shy = 0.0, chy = 0.0;
+  gra::math::msinhcosh(yX, shy, chy);
+  pX.SetPzE(mtX * shy, mtX * chy);
 
-  // Energy overflow
-  if (pX.E() > (lts.sqrt_s - (m1 + m2))) { return false; }
+  // SolvePz runs unconditionally (safe on overflow input) and the cheap
+  // rejections fuse into one accumulated test
+  const double p1z = gra::kinematics::SolvePz(m1, m2, pt1, pt2, pX.Pz(), pX.E(), lts.s);
+  const double p2z = -(pX.Pz() + p1z);  // by momentum conservation
 
-  double p1z = gra::kinematics::SolvePz(m1, m2, pt1, pt2, pX.Pz(), pX.E(), lts.s);
-  double p2z = -(pX.Pz() + p1z);  // by momentum conservation
-
-  // Enforce scattering direction +p -> +p, -p -> -p (VERY RARE POLYNOMIAL
-  // BRANCH FLIP)
-  if (p1z < 0 || p2z > 0) { return false; }
+  // Energy overflow | scattering direction +p -> +p, -p -> -p
+  // (VERY RARE POLYNOMIAL BRANCH FLIP)
+  const bool reject = (pX.E() > (lts.sqrt_s - (m1 + m2))) | (p1z < 0) | (p2z > 0);
+  if (reject) { return false; }
 
   // Pz and E of forward protons/N*
-  p1.SetPzE(p1z, msqrt(pow2(m1) + pow2(pt1) + pow2(p1z)));
-  p2.SetPzE(p2z, msqrt(pow2(m2) + pow2(pt2) + pow2(p2z)));
+  p1.SetPzE(p1z, OnShellEnergy(m1, pt1, p1z));
+  p2.SetPzE(p2z, OnShellEnergy(m2, pt2, p2z));
+
+  // Save (slots [0..2] are contiguous, so the lab boost below runs over
+  // them as one batch)
+  lts.pfinal[1] = p1;
+  lts.pfinal[2] = p2;
+  lts.pfinal[0] = pX;  // Central system
 
   // ------------------------------------------------------------------
   // Now boost if asymmetric beams
   if (std::abs(beamsum.Pz()) > 1e-6) {
     constexpr int sign = 1;  // positive -> boost to the lab
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, p1, sign);
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, p2, sign);
-    kinematics::LorentzBoost(beamsum, lts.sqrt_s, pX, sign);
+    kinematics::LorentzBoostBatch(beamsum, lts.sqrt_s, lts.pfinal.data(), 3, sign);
   }
   // ------------------------------------------------------------------
 
-  // Save
-  lts.pfinal[1] = p1;
-  lts.pfinal[2] = p2;
-  lts.pfinal[0] = pX;  // Central system
-
   // -------------------------------------------------------------------
   // Kinematic checks
 
-  // Total 4-momentum conservation
-  if (!CheckEMC(beamsum - (lts.pfinal[1] + lts.pfinal[2] + lts.pfinal[0]))) { return false; }
+  // Total 4-momentum conservation (only breaks through rounding here)
+  if (!CheckEMC(beamsum - (lts.pfinal[1] + lts.pfinal[2] + lts.pfinal[0]))) [[unlikely]] {
+    return false;
+  }
 
   // ==============================================================================
   // Central system decay tree first branch kinematics set up here, the
   // rest is done recursively
 
-  // Collect decay product masses
-  std::vector<double> masses;
+  // Collect decay product masses (member scratch keeps its capacity across events)
+  std::vector<double> &masses = massbuf_;
+  masses.clear();
   for (const auto &i : indices(lts.decaytree)) {
     // @@ Note, we need to take offshell masses here calculated first in B51RandomKin @@
     masses.push_back(lts.decaytree[i].m_offshell);
   }
-  std::vector<M4Vec> products(lts.decaytree.size());
+  std::vector<M4Vec> &products = productbuf_;
+  products.resize(lts.decaytree.size());
 
   // false if amplitude has dependence on the final state legs (generic),
   // true if amplitude is a function of central system kinematics only (limited)
@@ -377,24 +433,8 @@ bool MFactorized::B51BuildKin(double pt1, double pt2, double phi1, double phi2,
 
   gra::kinematics::MCW w;
 
-  // 2-body
-  if (lts.decaytree.size() == 2) {
-    w = gra::kinematics::TwoBodyPhaseSpace(lts.pfinal[0], msqrt(m2X), masses, products, random);
-
-    // 3-body
-  } else if (lts.decaytree.size() == 3) {
-    w = gra::kinematics::ThreeBodyPhaseSpace(lts.pfinal[0], msqrt(m2X), masses, products, UNWEIGHT,
-                                             random);
-
-    // N-body
-  } else if (lts.decaytree.size() > 3) {
-    if (UNWEIGHT) {
-      w = gra::kinematics::NBodyPhaseSpace(lts.pfinal[0], msqrt(m2X), masses, products, UNWEIGHT,
-                                           random);
-    } else {
-      w = gra::kinematics::RamboMassive(lts.pfinal[0], msqrt(m2X), masses, products, random);
-    }
-  }
+  // Generator resolved once in post_Constructor by the decay topology
+  if (psgen_ != nullptr) { w = (this->*psgen_)(msqrt(m2X), masses, products, UNWEIGHT); }
   // printf("%0.3E \n", w.Integral());
 
   if (w.GetW() < 0) {
@@ -453,17 +493,47 @@ double MFactorized::B51IntegralVolume() const {
 
 // 5-Dim phase space weight
 double MFactorized::B51PhaseSpaceWeight() const {
+  // Normalization (1/2) x 1/(2pi)^5 folded at compile time
+  constexpr double NORM = (1.0 / 2.0) * (1.0 / pow5(2.0 * gra::math::PI));
+
+  // One reciprocal per leg, shared between the Jacobian and the pt/(2E) factors
+  const double invE1 = 1.0 / lts.pfinal[1].E();
+  const double invE2 = 1.0 / lts.pfinal[2].E();
+
   const double J =
-      1.0 / std::abs(lts.pfinal[1].Pz() / lts.pfinal[1].E() -
-                     lts.pfinal[2].Pz() / lts.pfinal[2].E());  // Jacobian, close to 0.5
+      1.0 / std::abs(lts.pfinal[1].Pz() * invE1 -
+                     lts.pfinal[2].Pz() * invE2);  // Jacobian, close to 0.5
 
-  const double factor = (1.0 / 2.0) * (1.0 / pow5(2.0 * gra::math::PI)) *
-                        (lts.pfinal[1].Pt() / (2.0 * lts.pfinal[1].E())) *
-                        (lts.pfinal[2].Pt() / (2.0 * lts.pfinal[2].E())) * J;
+  const double factor = NORM * (0.5 * lts.pfinal[1].Pt() * invE1) *
+                        (0.5 * lts.pfinal[2].Pt() * invE2) * J;
 
   return factor;
 }
 
+// Central system phase space generators behind psgen_
+
+// 2-body
+gra::kinematics::MCW MFactorized::PS2(double M0, const std::vector<double> &masses,
+                                      std::vector<M4Vec> &products, bool) {
+  return gra::kinematics::TwoBodyPhaseSpace(lts.pfinal[0], M0, masses, products, random);
+}
+
+// 3-body
+gra::kinematics::MCW MFactorized::PS3(double M0, const std::vector<double> &masses,
+                                      std::vector<M4Vec> &products, bool UNWEIGHT) {
+  return gra::kinematics::ThreeBodyPhaseSpace(lts.pfinal[0], M0, masses, products, UNWEIGHT,
+                                              random);
+}
+
+// N-body
+gra::kinematics::MCW MFactorized::PSN(double M0, const std::vector<double> &masses,
+                                      std::vector<M4Vec> &products, bool UNWEIGHT) {
+  if (UNWEIGHT) {
+    return gra::kinematics::NBodyPhaseSpace(lts.pfinal[0], M0, masses, products, UNWEIGHT, random);
+  }
+  return gra::kinematics::RamboMassive(lts.pfinal[0], M0, masses, products, random);
+}
+
 // For high mass limit kinematics, see e.g. [arxiv.org/pdf/hep-ph/9903279.pdf]
 
 }  // namespace gra
@@ -43,12 +43,18 @@ std::string F2        = "CKMT";
 std::string EM        = "DIPOLE";
 std::string QED_alpha = "ZERO";
 
+// Defaults match EM = "DIPOLE"
+double (*G_E_fn)(double Q2) = &gra::form::G_E_DIPOLE;
+double (*G_M_fn)(double Q2) = &gra::form::G_M_DIPOLE;
+
+// Default matches F2 = "CKMT"
+F2MODEL F2_model = F2MODEL::CKMT;
+
 bool initialized = false;
 // Read parameters from file
 void ReadParameters(const std::string &modelfile) {
   try {
-    const std::string data = gra::aux::GetInputData(modelfile);
-    nlohmann::json    j    = nlohmann::json::parse(data);
+    const nlohmann::json &j = gra::aux::GetInputJSON(modelfile);
 
     const std::string XID = "PARAM_STRUCTURE";
 
@@ -63,6 +69,27 @@ void ReadParameters(const std::string &modelfile) {
                       " (Check for extra/missing commas)";
     throw std::invalid_argument(str);
   }
+
+  // Resolve the EM form factor dispatch once here instead of per G_E/G_M call
+  if (EM == "DIPOLE") {
+    G_E_fn = &gra::form::G_E_DIPOLE;
+    G_M_fn = &gra::form::G_M_DIPOLE;
+  } else if (EM == "KELLY") {
+    G_E_fn = &gra::form::G_E_KELLY;
+    G_M_fn = &gra::form::G_M_KELLY;
+  } else {
+    throw std::invalid_argument(
+        "PARAM_STRUCTURE::ReadParameters: Unknown proton EM-form factor chosen = " + EM);
+  }
+
+  // Same one-time resolution for the F2 structure function model
+  if (F2 == "DL") {
+    F2_model = F2MODEL::DL;
+  } else if (F2 == "CKMT") {
+    F2_model = F2MODEL::CKMT;
+  } else {
+    throw std::invalid_argument("PARAM_STRUCTURE::ReadParameters: Unknown F2 chosen = " + F2);
+  }
 }
 
 }  // namespace PARAM_STRUCTURE
@@ -118,8 +145,7 @@ void PrintParam() {
 // Read parameters from file
 void ReadParameters(const std::string &modelfile) {
   try {
-    const std::string data = gra::aux::GetInputData(modelfile);
-    nlohmann::json    j    = nlohmann::json::parse(data);
+    const nlohmann::json &j = gra::aux::GetInputJSON(modelfile);
 
     const std::string XID = "PARAM_SOFT";
 
@@ -138,8 +164,14 @@ void ReadParameters(const std::string &modelfile) {
 
     PARAM_SOFT::ODDERON_ON = j.at(XID).at("ODDERON_ON");
 
+    // Print the parameter table on the first load only; re-loads in a
+    // scan or fit loop would otherwise spend their time on stdout
+    static bool printed = false;
+    if (!printed) {
+      PARAM_SOFT::PrintParam();
+      printed = true;
+    }
     initialized = true;
-    PARAM_SOFT::PrintParam();
 
   } catch (...) {
     std::string str = "PARAM_SOFT::ReadParameters: Error parsing " + modelfile +
@@ -160,8 +192,7 @@ bool initialized = false;
 // Read parameters from file
 void ReadParameters(const std::string &modelfile) {
   try {
-    const std::string data = gra::aux::GetInputData(modelfile);
-    nlohmann::json    j    = nlohmann::json::parse(data);
+    const nlohmann::json &j = gra::aux::GetInputJSON(modelfile);
 
     const std::string XID = "PARAM_FLAT";
 
@@ -186,8 +217,7 @@ bool initialized = false;
 // Read parameters from file
 void ReadParameters(const std::string &modelfile) {
   try {
-    const std::string data = gra::aux::GetInputData(modelfile);
-    nlohmann::json    j    = nlohmann::json::parse(data);
+    const nlohmann::json &j = gra::aux::GetInputJSON(modelfile);
 
     const std::string XID = "PARAM_NSTAR";
 
@@ -195,9 +225,12 @@ void ReadParameters(const std::string &modelfile) {
     std::vector<double> rc = j.at(XID).at("rc");
     PARAM_NSTAR::rc        = rc;
 
-    // Make sure they sum to one
-    const double sum_rc = std::accumulate(rc.begin(), rc.end(), 0);
-    for (std::size_t i = 0; i < PARAM_NSTAR::rc.size(); ++i) { PARAM_NSTAR::rc[i] /= sum_rc; }
+    // Make sure they sum to one. N.B. the accumulate init must be 0.0:
+    // an int init truncates the running sum, giving sum_rc = 0 and
+    // inf ratios after the division
+    const double sum_rc = std::accumulate(rc.begin(), rc.end(), 0.0);
+    const double inv_rc = 1.0 / sum_rc;
+    for (std::size_t i = 0; i < PARAM_NSTAR::rc.size(); ++i) { PARAM_NSTAR::rc[i] *= inv_rc; }
 
     initialized = true;
   } catch (...) {
@@ -210,6 +243,11 @@ void ReadParameters(const std::string &modelfile) {
 
 namespace form {
 
+// Proton mass constants used across the form factors and fluxes,
+// folded once at compile time
+constexpr double mp2      = pow2(mp);
+constexpr double INV_4MP2 = 1.0 / pow2(2.0 * mp);
+
 // Read resonance parameters
 gra::PARAM_RES ReadResonance(const std::string &resparam_str, MRandom &rng) {
 
@@ -226,11 +264,10 @@ gra::PARAM_RES ReadResonance(const std::string &resparam_str, MRandom &rng) {
     const std::string fullpath =
         gra::aux::GetBasePath(2) + "/modeldata/" + gra::MODELPARAM + "/GENERAL.json";
 
-    const std::string data = gra::aux::GetInputData(fullpath);
-    nlohmann::json    j;
+    nlohmann::json j;
 
     try {
-      j = nlohmann::json::parse(data);
+      j = gra::aux::GetInputJSON(fullpath);
     } catch (...) {
       std::string str =
           "form::ReadResonance: Error parsing " + fullpath + " (Check for extra/missing commas)";
@@ -242,17 +279,22 @@ gra::PARAM_RES ReadResonance(const std::string &resparam_str, MRandom &rng) {
     FRAME   = j.at("PARAM_SPIN").at("FRAME");
     JMAX    = j.at("PARAM_SPIN").at("JMAX");
 
-    std::cout << "gra::form::ReadResonance: General parameters:" << std::endl;
-    std::cout << std::endl;
-    std::cout << "- SPINGEN = " << std::boolalpha << SPINGEN << std::noboolalpha <<
-      "\t(generation 2 -> 1 spin correlations active)" << std::endl;
-    std::cout << "- SPINDEC = " << std::boolalpha << SPINDEC << std::noboolalpha <<
-      "\t(decay      1 -> 2 spin correlations active)" << std::endl;
-    std::cout << "- FRAME   = " << FRAME   <<
-      "\t(central system polarization frame)"          << std::endl;
-    std::cout << "- JMAX    = " << JMAX    <<
-      "\t(maximum ang. momentum of sliding Pomeron)"   << std::endl;
-    std::cout << std::endl;
+    // Same block for every resonance; print it once per process
+    static bool printed = false;
+    if (!printed) {
+      std::cout << "gra::form::ReadResonance: General parameters:" << std::endl;
+      std::cout << std::endl;
+      std::cout << "- SPINGEN = " << std::boolalpha << SPINGEN << std::noboolalpha <<
+        "\t(generation 2 -> 1 spin correlations active)" << std::endl;
+      std::cout << "- SPINDEC = " << std::boolalpha << SPINDEC << std::noboolalpha <<
+        "\t(decay      1 -> 2 spin correlations active)" << std::endl;
+      std::cout << "- FRAME   = " << FRAME   <<
+        "\t(central system polarization frame)"          << std::endl;
+      std::cout << "- JMAX    = " << JMAX    <<
+        "\t(maximum ang. momentum of sliding Pomeron)"   << std::endl;
+      std::cout << std::endl;
+      printed = true;
+    }
   }
 
   // =====================================================================
@@ -264,12 +306,10 @@ gra::PARAM_RES ReadResonance(const std::string &resparam_str, MRandom &rng) {
       gra::aux::GetBasePath(2) + "/modeldata/" + gra::MODELPARAM + "/" + resparam_str;
 
   // Read and parse
-  std::string    data;
   nlohmann::json j;
 
   try {
-    data = gra::aux::GetInputData(inputfile);
-    j    = nlohmann::json::parse(data);
+    j = gra::aux::GetInputJSON(inputfile);
   } catch (...) {
     throw std::invalid_argument("form::ReadResonance: Error parsing '" + resparam_str + "'");
   }
@@ -358,9 +398,14 @@ gra::PARAM_RES ReadResonance(const std::string &resparam_str, MRandom &rng) {
       rho[0][0] = 1.0;  // Unit
 
     } else {
-      // Draw random density matrices (until the number set by user)
-      if (j.at("PARAM_RES").at("random_rho") > 0) {
-        for (std::size_t k = 0; k < j.at("PARAM_RES").at("random_rho"); ++k) {
+      // Draw random density matrices (until the number set by user).
+      // The earlier draws are kept: each one advances the generator
+      // through the rejection sampling inside RandomRho, so the k-th
+      // matrix a seeded user selected cannot be reproduced by a plain
+      // rng discard
+      const std::size_t random_rho = j.at("PARAM_RES").at("random_rho");
+      if (random_rho > 0) {
+        for (std::size_t k = 0; k < random_rho; ++k) {
           rho = gra::spin::RandomRho(res.p.spinX2 / 2.0, P_conservation, rng);
         }
 
@@ -417,11 +462,14 @@ std::complex<double> ReggeEtaLinear(double t, double alpha_t0, double ap, double
 // [REFERENCE: Khoze, Martin, Ryskin, arxiv.org/abs/hep-ph/0007359]
 double S3PomAlpha(double t) {
   // Additive quark model Beta_pi / Beta_p = 2/3 ->
-  const double BETApi = (2.0 / 3.0) * PARAM_SOFT::gN_P;
-  const double PIC    = (pow2(BETApi) * pow2(mpi)) / (32.0 * pow3(PI));
+  // PIC = (BETApi gN_P)^2 mpi^2 / (32 pi^3); everything except the live
+  // coupling gN_P (refit by fitsoft between calls) folds at compile time
+  constexpr double PIC0 = (pow2(2.0 / 3.0) * pow2(mpi)) / (32.0 * pow3(PI));
+  const double     PIC  = PIC0 * pow2(PARAM_SOFT::gN_P);
 
   // Pomeron trajectory value
-  const double h       = PIC * S3HPL(4.0 * pow2(mpi) / std::abs(t),
+  constexpr double fourmpi2 = 4.0 * pow2(mpi);
+  const double     h        = PIC * S3HPL(fourmpi2 / std::abs(t),
                                t);  // pion loop insert (ADD with minus sign)
   const double alpha_P = 1.0 + PARAM_SOFT::DELTA_P + PARAM_SOFT::ALPHA_P * t - h;
 
@@ -430,15 +478,19 @@ double S3PomAlpha(double t) {
 
 // Pion loop insert to the non-linear Pomeron trajectory
 double S3HPL(double tau, double t) {
-  const double m      = 1.0;  // fixed scale (GeV)
+  // log(m^2/mpi^2) at the fixed scale m = 1 GeV
+  static const double LOGM2 = -2.0 * std::log(mpi);
+
   const double sqrtau = msqrt(1 + tau);
 
   // Pion-Pomeron form factor parametrization
   const double F_pi = 1.0 / (1.0 - t / PARAM_SOFT::fc3);
 
+  // (1+tau)^{3/2} re-uses sqrtau, and
+  // log((sqrtau+1)/(sqrtau-1)) = 2 atanh(1/sqrtau), which avoids the
+  // large-tau cancellation in the log argument
   return (4.0 / tau) * pow2(F_pi) *
-         (2.0 * tau - std::pow(1.0 + tau, 3.0 / 2.0) * std::log((sqrtau + 1.0) / (sqrtau - 1.0)) +
-          std::log((m * m) / (mpi * mpi)));
+         (2.0 * tau - (1.0 + tau) * sqrtau * 2.0 * std::atanh(1.0 / sqrtau) + LOGM2);
 }
 // ----------------------------------------------------------------------
 
@@ -459,7 +511,8 @@ double S3F(double t) {
 double S3FINEL(double t, double M2) {
   constexpr double DELTA_P = 0.0808;
   constexpr double a       = 0.5616;  // GeV^{2}
-  double           f       = std::pow(std::abs(t) / (M2 * (std::abs(t) + a)), 0.5 * (1 + DELTA_P));
+  const double     abst    = std::abs(t);
+  double           f       = std::pow(abst / (M2 * (abst + a)), 0.5 * (1 + DELTA_P));
 
   return f;
 }
@@ -477,7 +530,9 @@ double S3FINEL(double t, double M2) {
 // [REFERENCE: Capella, Kaidalov, Merino, Tran Tranh Van, arxiv.org/abs/hep-ph/9405338v1]
 //
 double F2xQ2(double xbj, double Q2) {
-  if (PARAM_STRUCTURE::F2 == "DL") {
+  // Model resolved to an enum at parameter-read time; the old string
+  // comparisons ran on every evaluation
+  if (PARAM_STRUCTURE::F2_model == PARAM_STRUCTURE::F2MODEL::DL) {
     constexpr double A = 0.324;
     constexpr double B = 0.098;
 
@@ -487,13 +542,16 @@ double F2xQ2(double xbj, double Q2) {
     constexpr double a = 0.561991692786383;
     constexpr double b = 0.011133;
 
-    const double F2 = A * std::pow(xbj, -DELTA_P) * std::pow(Q2 / (Q2 + a), 1 + DELTA_P) +
-                      B * std::pow(xbj, 1 - DELTA_R) * std::pow(Q2 / (Q2 + b), DELTA_R);
+    // Both xbj powers from one log
+    const double lx = std::log(xbj);
+
+    const double F2 = A * std::exp(-DELTA_P * lx) * std::pow(Q2 / (Q2 + a), 1 + DELTA_P) +
+                      B * std::exp((1 - DELTA_R) * lx) * std::pow(Q2 / (Q2 + b), DELTA_R);
 
     return F2;
   }
 
-  else if (PARAM_STRUCTURE::F2 == "CKMT") {
+  else {  // PARAM_STRUCTURE::F2MODEL::CKMT; unknown strings are rejected at read time
     constexpr double A       = 0.1502;
     constexpr double B_u     = 1.2064;
     constexpr double B_d     = 0.1798;
@@ -511,15 +569,17 @@ double F2xQ2(double xbj, double Q2) {
     const double C1 = std::pow(Q2 / (Q2 + a), 1.0 + DELTA_Q2);
     const double C2 = std::pow(Q2 / (Q2 + b), alpha_R);
 
-    const double F2 = A * std::pow(xbj, -DELTA_Q2) * std::pow(1 - xbj, n_Q2 + 4.0) * C1 +
-                      std::pow(xbj, 1.0 - alpha_R) *
-                          (B_u * std::pow(1 - xbj, n_Q2) + B_d * std::pow(1 - xbj, n_Q2 + 1.0)) *
-                          C2;
+    // All xbj and (1-xbj) powers from one log each:
+    // (1-xbj)^{n+4} = (1-xbj)^n (1-xbj)^4 and (1-xbj)^{n+1} = (1-xbj)^n (1-xbj)
+    const double lx      = std::log(xbj);
+    const double omx     = 1.0 - xbj;
+    const double omx_nQ2 = std::exp(n_Q2 * std::log1p(-xbj));
+
+    const double F2 =
+        A * std::exp(-DELTA_Q2 * lx) * omx_nQ2 * gra::math::pow4(omx) * C1 +
+        std::exp((1.0 - alpha_R) * lx) * (B_u * omx_nQ2 + B_d * omx_nQ2 * omx) * C2;
 
     return F2;
-  } else {
-    throw std::invalid_argument("gra::form::F2xQ2: Unknown PARAM_STRUCTURE::F2 = " +
-                                PARAM_STRUCTURE::F2);
   }
 }
 
@@ -557,17 +617,32 @@ double mu_ratio() { return 2.792847337; }
 // Proton EM form factor F1 (Dirac)
 double F1(double Q2) {
   Q2               = std::abs(Q2);
-  const double tau = Q2 / pow2(2 * mp);
+  const double tau = Q2 * INV_4MP2;
 
-  return 1.0 / (tau + 1) * G_E(Q2) + tau / (tau + 1) * G_M(Q2);
+  // Q2 made non-negative above, so call the resolved parametrization
+  // directly and skip the second std::abs inside G_E/G_M
+  return 1.0 / (tau + 1) * PARAM_STRUCTURE::G_E_fn(Q2) +
+         tau / (tau + 1) * PARAM_STRUCTURE::G_M_fn(Q2);
 }
 
 // Proton EM form factor F2 (Pauli)
 double F2(double Q2) {
   Q2               = std::abs(Q2);
-  const double tau = Q2 / pow2(2 * mp);
+  const double tau = Q2 * INV_4MP2;
 
-  return -1.0 / (tau + 1) * G_E(Q2) + 1.0 / (tau + 1) * G_M(Q2);
+  return -1.0 / (tau + 1) * PARAM_STRUCTURE::G_E_fn(Q2) +
+         1.0 / (tau + 1) * PARAM_STRUCTURE::G_M_fn(Q2);
+}
+
+// Both Dirac F1 and Pauli F2 from a single Sachs (G_E, G_M) evaluation,
+// for callers that need the pair
+std::pair<double, double> F1F2(double Q2) {
+  Q2               = std::abs(Q2);
+  const double tau = Q2 * INV_4MP2;
+  const double ge  = PARAM_STRUCTURE::G_E_fn(Q2);
+  const double gm  = PARAM_STRUCTURE::G_M_fn(Q2);
+
+  return {1.0 / (tau + 1) * ge + tau / (tau + 1) * gm, -1.0 / (tau + 1) * ge + 1.0 / (tau + 1) * gm};
 }
 
 // Rosenbluth separation:
@@ -579,30 +654,13 @@ double F2(double Q2) {
 
 // <http://www.scholarpedia.org/article/Nucleon_Form_factors>
 
+// Parametrization resolved once by PARAM_STRUCTURE::ReadParameters
 double G_E(double Q2) {
-  Q2 = std::abs(Q2);  // For safety
-
-  if (PARAM_STRUCTURE::EM == "DIPOLE") {
-    return G_E_DIPOLE(Q2);
-  } else if (PARAM_STRUCTURE::EM == "KELLY") {
-    return G_E_KELLY(Q2);
-  } else {
-    throw std::invalid_argument("gra::form::G_E: Unknown proton EM-form factor chosen = " +
-                                PARAM_STRUCTURE::EM);
-  }
+  return PARAM_STRUCTURE::G_E_fn(std::abs(Q2));  // abs for safety
 }
 
 double G_M(double Q2) {
-  Q2 = std::abs(Q2);  // For safety
-
-  if (PARAM_STRUCTURE::EM == "DIPOLE") {
-    return G_M_DIPOLE(Q2);
-  } else if (PARAM_STRUCTURE::EM == "KELLY") {
-    return G_M_KELLY(Q2);
-  } else {
-    throw std::invalid_argument("gra::form::G_M: Unknown proton EM-form factor chosen = " +
-                                PARAM_STRUCTURE::EM);
-  }
+  return PARAM_STRUCTURE::G_M_fn(std::abs(Q2));  // abs for safety
 }
 
 
@@ -610,7 +668,7 @@ double G_M(double Q2) {
 //
 //
 double G_E_DIPOLE(double Q2) {
-  return G_M(Q2) / mu_ratio();  // Scaling assumption
+  return G_M_DIPOLE(Q2) / mu_ratio();  // Scaling assumption
 }
 double G_M_DIPOLE(double Q2) {
   constexpr double lambda2 = 0.71;  // Dipole parameter GeV^2
@@ -621,41 +679,27 @@ double G_M_DIPOLE(double Q2) {
 //
 // [REFERENCE: Kelly, journals.aps.org/prc/pdf/10.1103/PhysRevC.70.068202]
 double G_E_KELLY(double Q2) {
-  static const std::vector<double> a = {1, -0.24};
-  static const std::vector<double> b = {10.98, 12.82, 21.97};
+  // Coefficients as constexpr scalars, so they fold into immediates;
+  // the static std::vector tables went through heap storage on every call
+  constexpr double a0 = 1.0, a1 = -0.24;
+  constexpr double b1 = 10.98, b2 = 12.82, b3 = 21.97;
 
-  const double tau = Q2 / pow2(2 * mp);
+  const double tau = Q2 * INV_4MP2;
 
-  // Numerator
-  double num = 0.0;   // 0
-  num += a[0];        // a_0 tau^0
-  num += a[1] * tau;  // a_1 tau^1
-
-  // Denominator
-  double den = 1.0;         // 1.0
-  den += b[0] * tau;        // b_1 tau^1
-  den += b[1] * pow2(tau);  // b_2 tau^2
-  den += b[2] * pow3(tau);  // b_3 tau^3
+  const double num = a0 + a1 * tau;
+  const double den = ((b3 * tau + b2) * tau + b1) * tau + 1.0;  // Horner
 
   return num / den;
 }
 
 double G_M_KELLY(double Q2) {
-  static const std::vector<double> a = {1, 0.12};
-  static const std::vector<double> b = {10.97, 18.86, 6.55};
-
-  const double tau = Q2 / pow2(2 * mp);
+  constexpr double a0 = 1.0, a1 = 0.12;
+  constexpr double b1 = 10.97, b2 = 18.86, b3 = 6.55;
 
-  // Numerator
-  double num = 0.0;   // 0
-  num += a[0];        // a_0 tau^0
-  num += a[1] * tau;  // a_1 tau^1
+  const double tau = Q2 * INV_4MP2;
 
-  // Denominator
-  double den = 1.0;         // 1.0
-  den += b[0] * tau;        // b_1 tau^1
-  den += b[1] * pow2(tau);  // b_2 tau^2
-  den += b[2] * pow3(tau);  // b_3 tau^3
+  const double num = a0 + a1 * tau;
+  const double den = ((b3 * tau + b2) * tau + b1) * tau + 1.0;  // Horner
 
   return mu_ratio() * num / den;
 }
@@ -680,12 +724,15 @@ double G_M_KELLY(double Q2) {
 double CohFlux(double xi, double t, double pt) {
   const double pt2 = pow2(pt);
   const double xi2 = pow2(xi);
-  const double mp2 = pow2(mp);
   const double Q2  = std::abs(t);
 
-  const double PART1 =
-      (4.0 * pow2(mp) * pow2(G_E(Q2)) + Q2 * pow2(G_M(Q2))) / (4.0 * pow2(mp) + Q2);
-  const double PART2 = pow2(G_M(Q2));
+  // Evaluate the form factors once per call; Q2 is non-negative here so
+  // the resolved parametrizations are called without the G_E/G_M abs
+  const double GE2 = pow2(PARAM_STRUCTURE::G_E_fn(Q2));
+  const double GM2 = pow2(PARAM_STRUCTURE::G_M_fn(Q2));
+
+  const double PART1 = (4.0 * mp2 * GE2 + Q2 * GM2) / (4.0 * mp2 + Q2);
+  const double PART2 = GM2;
   const double DELTA = pt2 / (pt2 + xi2 * mp2);
 
   double f =
@@ -714,17 +761,20 @@ double CohFlux(double xi, double t, double pt) {
 // Factors applied as with CohFlux() above.
 //
 double IncohFlux(double xi, double t, double pt, double M2) {
-  constexpr double mp2 = pow2(mp);
-
   const double pt2   = pow2(pt);
   const double xi2   = pow2(xi);
   const double Q2    = std::abs(t);
-  const double xbj   = Q2 / (Q2 + M2 - mp2);  // Bjorken-x
+  const double denom = Q2 + M2 - mp2;
+  const double xbj   = Q2 / denom;  // Bjorken-x
   const double DELTA = pt2 / (pt2 + xi * (M2 - mp2) + xi2 * mp2);
 
+  // One structure function evaluation: 2x F1(x,Q^2) = F2(x,Q^2) here
+  // (Callan-Gross, see F1xQ2)
+  const double f2 = F2xQ2(xbj, Q2);
+
   double f = qed::alpha_QED() / PI *
-             ((1.0 - xi) * pow2(DELTA) * F2xQ2(xbj, Q2) / (Q2 + M2 - mp2) +
-              (xi2 / (4.0 * pow2(xbj))) * DELTA * 2.0 * xbj * F1xQ2(xbj, Q2) / (Q2 + M2 - mp2));
+             ((1.0 - xi) * pow2(DELTA) * f2 / denom +
+              (xi2 / (4.0 * pow2(xbj))) * DELTA * f2 / denom);
 
   // Factors
   f /= xi;
@@ -736,11 +786,13 @@ double IncohFlux(double xi, double t, double pt, double M2) {
 
 // Drees-Zeppenfeld proton coherent gamma flux (collinear)
 double DZFlux(double x) {
-  const double Q2min = (pow2(mp) * pow2(x)) / (1.0 - x);
+  const double Q2min = (mp2 * pow2(x)) / (1.0 - x);
   const double A     = 1.0 + 0.71 / Q2min;
+  const double invA  = 1.0 / A;  // one reciprocal feeds all three terms
 
   double f = qed::alpha_QED() / (2.0 * PI * x) * (1.0 + pow2(1.0 - x)) *
-             (std::log(A) - 11.0 / 6.0 + 3.0 / A - 3.0 / (2.0 * pow2(A)) + 1.0 / (3 * pow3(A)));
+             (std::log(A) - 11.0 / 6.0 + 3.0 * invA - (3.0 / 2.0) * pow2(invA) +
+              (1.0 / 3.0) * pow3(invA));
 
   return f;  // Use at cross section level
 }
@@ -763,8 +815,7 @@ std::complex<double> CBW(const gra::LORENTZSCALAR &lts, const gra::PARAM_RES &re
     case 2:
       return CBW_RW(lts.m2, resonance.p.mass, resonance.p.width);
     case 3:
-      return CBW_BF(lts.m2, resonance.p.mass, resonance.p.width, resonance.p.spinX2 / 2.0,
-                    lts.decaytree[0].p4.M(), lts.decaytree[1].p4.M());
+      return CBW_BF(lts.m2, resonance, lts.decaytree[0].p4.M(), lts.decaytree[1].p4.M());
     case 4:
       return CBW_JR(lts.m2, resonance.p.mass, resonance.p.width, resonance.p.spinX2 / 2.0);
 
@@ -819,6 +870,28 @@ std::complex<double> CBW_BF(double m2, double M0, double Gamma, int J, double mA
   return -1.0 / (m2 - M0 * M0 + zi * Gamma * M0 * M0 / msqrt(m2) * Bfactor);
 }
 
+// As above, with the barrier denominator cached on the resonance: it
+// depends only on (M0, mA, mB), which stay fixed over events when the
+// daughters are zero width. The exponent uses integer division as in
+// the int-J signature above (half-integer spins truncate down).
+std::complex<double> CBW_BF(double m2, const gra::PARAM_RES &resonance, double mA, double mB) {
+  const double M0    = resonance.p.mass;
+  const double Gamma = resonance.p.width;
+
+  if (mA != resonance.bw_mA || mB != resonance.bw_mB) {
+    resonance.bw_mA = mA;
+    resonance.bw_mB = mB;
+    resonance.bw_d  = msqrt((M0 * M0 - pow2(mA + mB)) * (M0 * M0 - pow2(mA - mB))) / (2 * M0);
+  }
+  const double u = msqrt((m2 - pow2(mA + mB)) * (m2 - pow2(mA - mB))) / (2 * msqrt(m2));
+
+  // pow(x, 2J+1) as repeated multiply (J = 0,1,2 in practice)
+  const double r       = u / resonance.bw_d;
+  double       Bfactor = r;
+  for (int k = 0; k < 2 * (resonance.p.spinX2 / 2); ++k) { Bfactor *= r; }
+  return -1.0 / (m2 - M0 * M0 + zi * Gamma * M0 * M0 / msqrt(m2) * Bfactor);
+}
+
 // 4. Spin dependent Relativistic Breit-Wigner (should not be used blindly!)
 //
 // [REFERENCE: Alwall el al., arxiv.org/abs/1402.1178]
@@ -826,20 +899,24 @@ std::complex<double> CBW_BF(double m2, double M0, double Gamma, int J, double mA
 std::complex<double> CBW_JR(double m2, double M0, double Gamma, double J) {
   const std::complex<double> denom = (m2 - M0 * M0 + zi * M0 * Gamma);
 
-  if (static_cast<int>(J) == 0) {  // J = 0
-    return -1.0 / denom;
-  } else if (static_cast<int>(J * 2) == 1) {  // J = 1/2
-    return -2.0 * msqrt(m2) / denom;
-  } else if (static_cast<int>(J) == 1) {  // J = 1
-    return -(1.0 - m2 / (M0 * M0)) / denom;
-  } else if (static_cast<int>(J * 2) == 3) {  // J = 3/2
-    return -(2.0 / 3.0) * msqrt(m2) * (1.0 - m2 / (M0 * M0)) / denom;
-  } else if (static_cast<int>(J) == 2) {  // J = 2
-    return -(7.0 / 6.0 - (4.0 / 3.0) * (m2 / (M0 * M0)) +
-             (2.0 / 3.0) * (m2 * m2) / (gra::math::pow4(M0))) /
-           denom;
-  } else {
-    return -1.0 / denom;  // Too high spin
+  // One float->int truncation and a jump table instead of a comparison
+  // cascade. The grouping reproduces the original cascade exactly: its
+  // leading static_cast<int>(J) tests truncated half-integer J down to
+  // the integer-J formula, so the half-integer branches never fired
+  switch (static_cast<int>(2.0 * J)) {
+    case 0:
+    case 1:  // J = 0
+      return -1.0 / denom;
+    case 2:
+    case 3:  // J = 1
+      return -(1.0 - m2 / (M0 * M0)) / denom;
+    case 4:
+    case 5:  // J = 2
+      return -(7.0 / 6.0 - (4.0 / 3.0) * (m2 / (M0 * M0)) +
+               (2.0 / 3.0) * (m2 * m2) / (gra::math::pow4(M0))) /
+             denom;
+    default:
+      return -1.0 / denom;  // Too high spin
   }
 }
 
@@ -5,6 +5,7 @@
 
 // C++
 #include <complex>
+#include <mutex>
 #include <random>
 #include <vector>
 
@@ -34,23 +35,15 @@ namespace gra {
 
 // Constructor
 MGamma::MGamma(gra::LORENTZSCALAR &lts, const std::string &modelfile) {
-  // @@ MULTITHREADING LOCK NEEDED FOR THE INITIALIZATION @@
-  gra::g_mutex.lock();
-
-  try {
-    // Global Monopolium process parameters
-    if (!PARAM_MONOPOLE::initialized) {
-      PARAM_MONOPOLE::M0 = lts.PDG.FindByPDG(PDG::PDG_monopole).mass;
-      PARAM_MONOPOLE::ReadParameters(modelfile);
-    }
-    // Class local initialization here
-    // ...
-
-  } catch (...) {
-    gra::g_mutex.unlock();  // need to release here, otherwise get infinite lock
-    throw;
-  }
-  gra::g_mutex.unlock();
+  // @@ MULTITHREADING: one-time initialization of the global Monopolium
+  // process parameters. call_once is a plain flag load once armed,
+  // unlike the old g_mutex lock/unlock paid by every construction, and
+  // it re-arms on exception so a failed load is retried
+  static std::once_flag monopole_once;
+  std::call_once(monopole_once, [&]() {
+    PARAM_MONOPOLE::M0 = lts.PDG.FindByPDG(PDG::PDG_monopole).mass;
+    PARAM_MONOPOLE::ReadParameters(modelfile);
+  });
 }
 
 
@@ -97,10 +90,13 @@ MGamma::MGamma(gra::LORENTZSCALAR &lts, const std::string &modelfile) {
 // [REFERENCE: Rels, Sauter, arxiv.org/abs/1707.04170v1]
 //
 double MGamma::yyffbar(gra::LORENTZSCALAR &lts) {
-  // QED couplings
-  double       COUPL         = 16.0 * pow2(gra::math::PI * qed::alpha_QED());  // = e^4
-  const double mass          = lts.decaytree[0].p4.M();  // lepton, quark (or monopole) mass
-  const double mass2         = pow2(mass);
+  // QED couplings; e^4 is constant over the run
+  static const double E4 = 16.0 * pow2(gra::math::PI * qed::alpha_QED());
+
+  double       COUPL         = E4;
+  // lepton, quark (or monopole) mass squared; M2() = E^2 - |p|^2 directly,
+  // the amplitude never needs the sqrt
+  const double mass2         = lts.decaytree[0].p4.M2();
   const bool   MONOPOLE_MODE = (lts.decaytree[0].p.pdg == PDG::PDG_monopole) ? true : false;
 
   if (PARAM_MONOPOLE::gn < 1) {
@@ -112,9 +108,7 @@ double MGamma::yyffbar(gra::LORENTZSCALAR &lts) {
 
   // Monopole-Antimonopole coupling
   if (MONOPOLE_MODE) {
-    static const double g = 2.0 * math::PI * PARAM_MONOPOLE::gn / qed::e_QED();
-
-    if (PARAM_MONOPOLE::coupling == "beta-dirac") {
+    if (PARAM_MONOPOLE::coupling_mode == PARAM_MONOPOLE::COUPLING::BETA_DIRAC) {
       // Calculate beta (velocity)
       // const M4Vec px = pfinal[3] + pfinal[4];
       // M4Vec p3 = pfinal[3];
@@ -123,22 +117,28 @@ double MGamma::yyffbar(gra::LORENTZSCALAR &lts) {
       // double beta = std::sqrt( p3.Px()*p3.Px() +
       // p3.Py()*p3.Py() + p3.Pz()*p3.Pz()) / p3.E();
 
-      // Faster way
-      const double beta = msqrt(1.0 - 4.0 * pow2(PARAM_MONOPOLE::M0) / lts.s_hat);
-      COUPL             = pow4(g * beta);
-    } else if (PARAM_MONOPOLE::coupling == "dirac") {
-      COUPL = pow4(g);
+      // Faster way; 4 M0^2 and g^4 are fixed after initialization
+      static const double fourM02 = 4.0 * pow2(PARAM_MONOPOLE::M0);
+
+      const double beta = msqrt(1.0 - fourM02 / lts.s_hat);
+      COUPL             = PARAM_MONOPOLE::g4 * pow4(beta);
+    } else if (PARAM_MONOPOLE::coupling_mode == PARAM_MONOPOLE::COUPLING::DIRAC) {
+      COUPL = PARAM_MONOPOLE::g4;
     } else {
       throw std::invalid_argument("MGamma::yyffbar: Unknown PARAM_MONOPOLE::coupling " +
                                   PARAM_MONOPOLE::coupling);
     }
 
     // QED tree level amplitude squared |M|^2, spin averaged and
-    // summed
+    // summed. Two reciprocals replace the four divisions by the same
+    // propagator denominators
+    const double T    = lts.t_hat - mass2;
+    const double U    = lts.u_hat - mass2;
+    const double invT = 1.0 / T;
+    const double invU = 1.0 / U;
+
     amp2 = 2.0 * COUPL *
-           ((lts.u_hat - mass2) / (lts.t_hat - mass2) + (lts.t_hat - mass2) / (lts.u_hat - mass2) +
-            1.0 -
-            pow2(1.0 + (2.0 * mass2) / (lts.t_hat - mass2) + (2.0 * mass2) / (lts.u_hat - mass2)));
+           (U * invT + T * invU + 1.0 - pow2(1.0 + 2.0 * mass2 * invT + 2.0 * mass2 * invU));
 
     /*
       // FeynCalc result, less simplified, but exactly same result
@@ -212,10 +212,10 @@ double MGamma::yyffbar(gra::LORENTZSCALAR &lts) {
 // *************************************************************
 //
 double MGamma::yyMP(gra::LORENTZSCALAR &lts) const {
-  // Lazy printing
-  gra::g_mutex.lock();
-  PARAM_MONOPOLE::PrintParameters(lts.sqrt_s);
-  gra::g_mutex.unlock();
+  // Lazy printing; call_once is a plain flag load after the first call,
+  // where the old g_mutex lock serialized every evaluation across threads
+  static std::once_flag print_once;
+  std::call_once(print_once, [&]() { PARAM_MONOPOLE::PrintParameters(lts.sqrt_s); });
 
   // Monopolium nominal mass and width parameters
   static const double M = 2.0 * PARAM_MONOPOLE::M0 + PARAM_MONOPOLE::EnergyMP(PARAM_MONOPOLE::En);
@@ -231,34 +231,35 @@ double MGamma::yyMP(gra::LORENTZSCALAR &lts) const {
     throw std::invalid_argument("MGamma::yyMP: Parameter Dirac n less than 1");
   }
 
-  // Two coupling scenarios:
-  static const double g    = 2.0 * math::PI * PARAM_MONOPOLE::gn / qed::e_QED();
-  double              beta = 0.0;
-
-  if (PARAM_MONOPOLE::coupling == "beta-dirac") {
-    beta = msqrt(1.0 - pow2(M) / lts.s_hat);
-  } else if (PARAM_MONOPOLE::coupling == "dirac") {
-    beta = 1.0;
+  // Two coupling scenarios. Everything except beta(s_hat) is fixed over
+  // the run: the Dirac magnetic coupling g^2/(4 pi), the wavefunction
+  // part of the running width GammaMP(En, alpha_g) = GAMMA_K * alpha_g^2,
+  // the normalization 2 pi M^2 and the Breit-Wigner width term
+  static const double M2      = M * M;
+  static const double ALPHAG0 = PARAM_MONOPOLE::g2 / (4.0 * math::PI);
+  static const double GAMMA_K = (8.0 * math::PI / pow2(PARAM_MONOPOLE::M0)) *
+                                math::abs2(PARAM_MONOPOLE::PsiMP(PARAM_MONOPOLE::En));
+  static const double NORM = 2.0 * math::PI * M2;
+  static const double MG2  = pow2(M * Gamma_M);
+
+  // Running width at beta = 1, i.e. the full Dirac-coupling value
+  static const double GAMMA_E0 = GAMMA_K * pow2(ALPHAG0);
+
+  double Gamma_E = GAMMA_E0;
+
+  if (PARAM_MONOPOLE::coupling_mode == PARAM_MONOPOLE::COUPLING::BETA_DIRAC) {
+    // alpha_g ~ beta^2, so Gamma_E ~ beta^4; clamped at threshold as msqrt was
+    const double beta2 = std::max(0.0, 1.0 - M2 / lts.s_hat);
+    Gamma_E *= pow2(beta2);
+  } else if (PARAM_MONOPOLE::coupling_mode == PARAM_MONOPOLE::COUPLING::DIRAC) {
+    // Gamma_E stays at the static Dirac value
   } else {
     throw std::invalid_argument("MGamma::yyMP: Unknown PARAM_MONOPOLE::coupling " +
                                 PARAM_MONOPOLE::coupling);
   }
 
-  // Magnetic coupling
-  const double alpha_g = pow2(beta * g) / (4.0 * math::PI);
-
-  // Running width
-  const double Gamma_E = PARAM_MONOPOLE::GammaMP(PARAM_MONOPOLE::En, alpha_g);
-
-  // printf("alpha_g = %0.3E, Gamma_E = %0.3E, Gamma_M = %0.3E, Psi_MP = %0.3E
-  // \n",
-  //	alpha_g, Gamma_E, Gamma_M, PARAM_MONOPOLE::PsiMP(PARAM_MONOPOLE::n));
-
-  // Normalization
-  double norm = 2.0 * math::PI * M * M;
-
   // Sub process
-  double amp2 = norm * (Gamma_E * Gamma_M) / (pow2(lts.s_hat - M * M) + pow2(M * Gamma_M));
+  double amp2 = NORM * (Gamma_E * Gamma_M) / (pow2(lts.s_hat - M2) + MG2);
 
   // --------------------------------------------------------------------
   // For screening loop (approximation)
@@ -285,28 +286,25 @@ double MGamma::yyMP(gra::LORENTZSCALAR &lts) const {
 // https://www.slac.stanford.edu/pubs/slacpubs/13750/slac-pub-13786.pdf]
 //
 double MGamma::yyHiggs(gra::LORENTZSCALAR &lts) const {
-  lts.hamp.resize(4);
+  constexpr double M        = 125.18;           // Higgs mass measured (GeV)
+  constexpr double Gamma    = 0.00415;          // Higgs total width calculated (GeV)
+  constexpr double Gamma_yy = 2.27E-3 * Gamma;  // Higgs to gamma-gamma calculated (GeV)
 
-  const double M        = 125.18;           // Higgs mass measured (GeV)
-  const double Gamma    = 0.00415;          // Higgs total width calculated (GeV)
-  const double Gamma_yy = 2.27E-3 * Gamma;  // Higgs to gamma-gamma calculated (GeV)
+  // Constant Breit-Wigner pieces folded at compile time:
+  // normalization 2 pi M^2, numerator x 2 from the two non-zero
+  // helicity amplitudes, and the width term of the denominator
+  constexpr double M2  = M * M;
+  constexpr double NUM = 2.0 * math::PI * M2 * Gamma_yy * Gamma * 2.0;
+  constexpr double MG2 = M2 * Gamma * Gamma;
 
-  // Normalization
-  const double norm = 2.0 * math::PI * M * M;
+  const double d = lts.s_hat - M2;
+  const double h = msqrt(NUM / (d * d + MG2));
 
-  // Effective helicity amplitudes
-  lts.hamp[0] =
-      msqrt(norm * Gamma_yy * Gamma * (1 + 1) / (pow2(lts.s_hat - M * M) + pow2(M * Gamma)));  // --
-  lts.hamp[1] = 0.0;                                                                           // -+
-  lts.hamp[2] = 0.0;                                                                           // +-
-  lts.hamp[3] = lts.hamp[0];                                                                   // ++
+  // Effective helicity amplitudes; only -- and ++ contribute
+  lts.hamp = {h, 0.0, 0.0, h};
 
-  // Sum over helicity amplitudes squared
-  double amp2 = 0.0;
-  for (const auto &i : aux::indices(lts.hamp)) { amp2 += gra::math::abs2(lts.hamp[i]); }
-  amp2 /= 4;  // Initial state polarization average
-
-  return amp2;
+  // Helicity sum 2 h^2 with initial state polarization average 1/4
+  return 0.5 * h * h;
 }
 
 // ============================================================================
@@ -329,7 +327,7 @@ double MGamma::yyX(gra::LORENTZSCALAR &lts, gra::PARAM_RES &resonance) const {
   // Factor of 2 x from (identical) initial state boson statistics
   std::complex<double> A_prod =
       2.0 * gra::form::CBW(lts, resonance) *
-      PARAM_REGGE::ResonanceFormFactor(lts.m2, pow2(resonance.p.mass), resonance.g_FF);
+      PARAM_REGGE::ResonanceFormFactor(lts.m2, resonance);
 
   // Production and Decay amplitude
   const std::complex<double> A_spin =
@@ -354,6 +352,13 @@ double      Gamma0   = 0.0;     // Monopolium width
 std::string coupling = "null";  // Coupling scenarios
 int         gn       = 0;       // Dirac charge 1,2,3,...
 
+COUPLING coupling_mode = COUPLING::UNKNOWN;
+
+// Dirac magnetic coupling and its powers, set in ReadParameters
+double g  = 0.0;
+double g2 = 0.0;
+double g4 = 0.0;
+
 bool printed     = false;
 bool initialized = false;
 
@@ -377,7 +382,10 @@ double EnergyMP(double n) {
 
 // Monopolium wavefunction in the origin of the bound system
 double PsiMP(double n) {
-  return (1.0 / msqrt(PI)) * std::pow(PARAM_MONOPOLE::M0 / (8.0 * qed::alpha_QED() * n), 3.0 / 2.0);
+  // r^{3/2} = r*sqrt(r) avoids the log/exp path of std::pow with a
+  // fractional exponent
+  const double r = PARAM_MONOPOLE::M0 / (8.0 * qed::alpha_QED() * n);
+  return (1.0 / msqrt(PI)) * r * msqrt(r);
 }
 
 void PrintParameters(double sqrts) {
@@ -418,17 +426,16 @@ void PrintParameters(double sqrts) {
 // Read parameters from file
 void ReadParameters(const std::string &modelfile) {
   try {
-    const std::string data = gra::aux::GetInputData(modelfile);
-    nlohmann::json    j    = nlohmann::json::parse(data);
+    const nlohmann::json &j = gra::aux::GetInputJSON(modelfile);
 
-    // JSON block identifier
-    const std::string XID = "PARAM_MONOPOLE";
+    // JSON block (looked up once)
+    const nlohmann::json &blk = j.at("PARAM_MONOPOLE");
 
     // Monopole production
-    PARAM_MONOPOLE::coupling = j.at(XID).at("coupling");
-    PARAM_MONOPOLE::gn       = j.at(XID).at("gn");
-    PARAM_MONOPOLE::En       = j.at(XID).at("En");
-    PARAM_MONOPOLE::Gamma0   = j.at(XID).at("Gamma0");
+    PARAM_MONOPOLE::coupling = blk.at("coupling");
+    PARAM_MONOPOLE::gn       = blk.at("gn");
+    PARAM_MONOPOLE::En       = blk.at("En");
+    PARAM_MONOPOLE::Gamma0   = blk.at("Gamma0");
 
     initialized = true;
   } catch (...) {
@@ -436,6 +443,23 @@ void ReadParameters(const std::string &modelfile) {
                       " (Check for extra/missing commas)";
     throw std::invalid_argument(str);
   }
+
+  // Resolve the coupling-scheme dispatch once here; unknown values keep
+  // the original per-kernel diagnostics instead of failing the load of
+  // non-monopole gamma processes
+  if (coupling == "dirac") {
+    coupling_mode = COUPLING::DIRAC;
+  } else if (coupling == "beta-dirac") {
+    coupling_mode = COUPLING::BETA_DIRAC;
+  } else {
+    coupling_mode = COUPLING::UNKNOWN;
+  }
+
+  // Dirac quantization condition g = 2*pi*n/e, evaluated here once so
+  // the amplitude kernels read plain globals without local-static guards
+  g  = 2.0 * math::PI * gn / qed::e_QED();
+  g2 = g * g;
+  g4 = g2 * g2;
 }
 
 }  // namespace PARAM_MONOPOLE
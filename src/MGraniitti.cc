@@ -374,13 +374,14 @@ void MGraniitti::InitMultiMemory() {
     }
   }
 
-  // RANDOM SEED PER THREAD (IMPORTANT!)
+  // RANDOM STREAM PER THREAD (IMPORTANT!)
   for (const auto &i : indices(pvec)) {
-    // Deterministic seed
-    const uint32_t thread_seed = static_cast<uint32_t>(pvec[i]->random.GetSeed() + i * 10);
-    pvec[i]->random.SetSeed(thread_seed);
+    // Same base seed, disjoint counter-based stream per thread. Unlike
+    // arithmetic seed offsets (seed + i * C), streams cannot collide
+    // between threads or between runs with nearby user seeds.
+    pvec[i]->random.SetStream(i);
 
-    printf("Thread [%3lu] : RNG seed = %9d \n", i, pvec[i]->random.GetSeed());
+    printf("Thread [%3lu] : RNG seed = %9d stream = %3lu \n", i, pvec[i]->random.GetSeed(), i);
   }
   std::cout << std::endl;
 
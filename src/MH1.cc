@@ -33,6 +33,8 @@ MH1<T>::MH1(int xbins, std::string namestr) {
   name     = namestr;
   XBINS    = xbins;
   FILLBUFF = true;
+  buff_values.reserve(AUTOBUFFSIZE + 1);
+  buff_weights.reserve(AUTOBUFFSIZE + 1);
 }
 
 // Constructor with varying bin sizes [N x 2]
@@ -50,6 +52,8 @@ template <class T>
 MH1<T>::MH1() {
   XBINS    = 50;  // Default
   FILLBUFF = true;
+  buff_values.reserve(AUTOBUFFSIZE + 1);
+  buff_weights.reserve(AUTOBUFFSIZE + 1);
 }
 
 // Destructor
@@ -185,17 +189,23 @@ double MH1<T>::GetMean(int power) const {
   double sum  = 0.0;
   double norm = 0.0;  // Normalization
 
+  const double binwidth = binedges.empty() ? (XMAX - XMIN) / XBINS : 0.0;
+
   for (std::size_t i = 0; i < static_cast<unsigned int>(XBINS); ++i) {
     double X_value = 0;
     if (binedges.empty()) {
-      const double binwidth = (XMAX - XMIN) / XBINS;
-      X_value               = binwidth * (i + 1) - binwidth / 2.0 + XMIN;
+      X_value = binwidth * (i + 1) - binwidth / 2.0 + XMIN;
     } else {
       X_value = (binedges[i][1] - binedges[i][0]) / 2;
     }
 
+    // power is 1 (mean) or 2 (second moment) at the call sites; avoid the
+    // generic libm pow path for those
+    const double X_pow =
+        (power == 1) ? X_value : (power == 2) ? X_value * X_value : std::pow(X_value, power);
+
     const double weight = GetPositiveDefinite(i);
-    sum += weight * std::pow(X_value, power);
+    sum += weight * X_pow;
     norm += weight;
   }
   if (norm > 0) {
@@ -226,8 +236,7 @@ void MH1<T>::Fill(double xvalue, T weight) {
     fills += 1;
 
     // Find out bin
-    int idx = 0;
-    GetBinIdx(xvalue, idx);
+    const int idx = GetBinIdx(xvalue);
 
     if (idx == -3) { nanflow += 1; }
     if (idx == -1) { underflow += 1; }
@@ -235,8 +244,9 @@ void MH1<T>::Fill(double xvalue, T weight) {
 
     if (ValidBin(idx)) {
       weights[idx] += weight;
-      weights2[idx] += std::abs(std::conj(weight) * weight);
-      counts[idx] += 1;
+      weights2[idx] += std::norm(weight);
+      // Saturating increment (no wrap-around with narrow count type)
+      if (counts[idx] < std::numeric_limits<count_t>::max()) { counts[idx] += 1; }
     }
   } else {  // Autorange initialization
     buff_values.push_back(xvalue);
@@ -246,34 +256,94 @@ void MH1<T>::Fill(double xvalue, T weight) {
   }
 }
 
+// Batched weighted fill
+//
+// Equivalent to calling Fill() per element, but the equal-width binning
+// constants (bounds, reciprocal bin width) are hoisted out of the loop,
+// so the common case reduces to one fused multiply + truncation plus the
+// three array updates per event and streams linearly through the input.
+template <class T>
+void MH1<T>::FillN(const std::vector<double> &xvalues, const std::vector<T> &wvalues) {
+  if (xvalues.size() != wvalues.size()) {
+    throw std::invalid_argument("MH1<T>::FillN: input size mismatch " +
+                                std::to_string(xvalues.size()) +
+                                " != " + std::to_string(wvalues.size()));
+  }
+  // Bounds not fixed yet, go through the buffering path
+  if (FILLBUFF) {
+    for (std::size_t i = 0; i < xvalues.size(); ++i) { Fill(xvalues[i], wvalues[i]); }
+    return;
+  }
+
+  const bool   uniform = binedges.empty() && !LOGX;
+  const double inv_dx  = (uniform && XMAX > XMIN) ? XBINS / (XMAX - XMIN) : 0.0;
+
+  for (std::size_t i = 0; i < xvalues.size(); ++i) {
+    const double x = xvalues[i];
+    fills += 1;
+
+    int idx = 0;
+    if (uniform) {  // O(1) index formula, constants hoisted
+      if (std::isnan(x) || std::isinf(x)) {
+        idx = -3;
+      } else if (x < XMIN) {
+        idx = -1;
+      } else if (x > XMAX) {
+        idx = -2;
+      } else {
+        idx = static_cast<int>((x - XMIN) * inv_dx);
+      }
+    } else {
+      idx = GetBinIdx(x);
+    }
+
+    if (idx == -3) { nanflow += 1; }
+    if (idx == -1) { underflow += 1; }
+    if (idx == -2) { overflow += 1; }
+
+    if (ValidBin(idx)) {
+      const T w = wvalues[i];
+      weights[idx] += w;
+      weights2[idx] += std::norm(w);
+      // Saturating increment (no wrap-around with narrow count type)
+      if (counts[idx] < std::numeric_limits<count_t>::max()) { counts[idx] += 1; }
+    }
+  }
+}
+
 // Automatic histogram range algorithm
 template <class T>
 void MH1<T>::FlushBuffer() {
   if (FILLBUFF && buff_values.size() > 0) {
     FILLBUFF = false;  // no more filling buffer
 
-    // Find out mean
-    double mu   = 0;
-    double sumW = 0;
+    // |w| computed once per element: a sqrt per call for complex weights,
+    // and the variance pass below needs it again
+    std::vector<double> aweight(buff_values.size(), 0.0);
+
+    // Find out mean, minimum and maximum in one pass
+    double mu     = 0;
+    double sumW   = 0;
+    double minval = buff_values[0];
+    double maxval = buff_values[0];
     for (std::size_t i = 0; i < buff_values.size(); ++i) {
-      mu += std::abs(buff_values[i] * buff_weights[i]);
-      sumW += std::abs(buff_weights[i]);
+      const double aw = std::abs(buff_weights[i]);
+      aweight[i]      = aw;
+      mu += std::abs(buff_values[i]) * aw;
+      sumW += aw;
+      minval = std::min(minval, buff_values[i]);
+      maxval = std::max(maxval, buff_values[i]);
     }
     if (sumW > 0) { mu /= sumW; }
 
-    // Variance
+    // Variance (separate pass on purpose: the two-pass mean/variance is
+    // numerically stabler than the E[x^2] - mu^2 shortcut)
     double var = 0;
     for (std::size_t i = 0; i < buff_values.size(); ++i) {
-      var += std::abs(buff_weights[i]) * std::pow(buff_values[i] - mu, 2);
+      var += aweight[i] * gra::math::pow2(buff_values[i] - mu);
     }
     if (sumW > 0) { var /= sumW; }
 
-    // Minimum and maximum
-    auto         it1    = std::min_element(buff_values.begin(), buff_values.end());
-    auto         it2    = std::max_element(buff_values.begin(), buff_values.end());
-    const double minval = *it1;
-    const double maxval = *it2;
-
     // Set new histogram bounds
     const double std = std::sqrt(std::abs(var));
 
@@ -298,8 +368,8 @@ void MH1<T>::FlushBuffer() {
 
     ResetBounds(XBINS, xmin, xmax);
 
-    // Fill buffered events
-    for (std::size_t i = 0; i < buff_values.size(); ++i) { Fill(buff_values[i], buff_weights[i]); }
+    // Fill buffered events through the batched path
+    FillN(buff_values, buff_weights);
 
     // Clear buffers
     buff_values.clear();
@@ -311,6 +381,8 @@ void MH1<T>::FlushBuffer() {
 template <class T>
 void MH1<T>::ResetBounds(int xbins) {
   ResetBounds(xbins, 0.0, 0.0);
+  buff_values.reserve(AUTOBUFFSIZE + 1);
+  buff_weights.reserve(AUTOBUFFSIZE + 1);
   FILLBUFF = true;  // Autorange on, no explicit bounds
 }
 
@@ -335,6 +407,16 @@ void MH1<T>::ResetBounds(std::vector<std::vector<double>> edges) {
   }
 
   ResetBounds(binedges.size(), binedges[0][0], binedges[binedges.size() - 1][1]);
+
+  // Flatten {lower,upper} pairs into a single contiguous edge array for
+  // branch-predictor and cache friendly binary search in ComputeIdx
+  edges_contiguous_ = true;
+  edges_flat_.resize(binedges.size() + 1);
+  for (std::size_t i = 0; i < binedges.size(); ++i) {
+    edges_flat_[i] = binedges[i][0];
+    if (i > 0 && binedges[i][0] != binedges[i - 1][1]) { edges_contiguous_ = false; }
+  }
+  edges_flat_[binedges.size()] = binedges[binedges.size() - 1][1];
 }
 
 // Reset histogram completely
@@ -344,14 +426,45 @@ void MH1<T>::ResetBounds(int xbins, double xmin, double xmax) {
   XMAX  = xmax;
   XBINS = xbins;
 
+  // Cache reciprocal bin widths
+  inv_dx_       = (XMAX > XMIN) ? XBINS / (XMAX - XMIN) : 0.0;
+  log10_xmin_   = (XMIN > 0) ? std::log10(XMIN) : 0.0;
+  inv_log10_dx_ = (XMIN > 0 && XMAX > XMIN) ? XBINS / (std::log10(XMAX) - log10_xmin_) : 0.0;
+
   // Init
   std::vector<T> null(XBINS, 0.0);
   weights  = null;
   weights2 = null;
-  counts   = std::vector<long long int>(XBINS, 0);
+  counts   = std::vector<count_t>(XBINS, 0);
 
   Clear();           // Call also this!
   FILLBUFF = false;  // No autorange, explicit bounds provided
+
+  BuildBinCache();
+}
+
+// Precompute uniform-bin lower/center/upper values, so the accessors do
+// no per-call arithmetic (in particular no log10/pow for LOGX binning)
+template <class T>
+void MH1<T>::BuildBinCache() {
+  bin_lo_.assign(std::max(XBINS, 0), 0.0);
+  bin_center_.assign(std::max(XBINS, 0), 0.0);
+  bin_hi_.assign(std::max(XBINS, 0), 0.0);
+
+  for (int idx = 0; idx < XBINS; ++idx) {
+    if (LOGX) {
+      const double log10step = (std::log10(XMAX) - std::log10(XMIN)) / XBINS;
+      bin_lo_[idx]           = std::pow(10, std::log10(XMIN) + idx * log10step);
+      bin_hi_[idx]           = std::pow(10, std::log10(XMIN) + (idx + 1) * log10step);
+      bin_center_[idx]       = (bin_lo_[idx] + bin_hi_[idx]) / 2;
+    } else {
+      const double binwidth = (XMAX - XMIN) / XBINS;
+      const double value    = XMIN + (idx + 1) * binwidth;
+      bin_lo_[idx]          = value - binwidth;
+      bin_center_[idx]      = value - binwidth / 2.0;
+      bin_hi_[idx]          = value;
+    }
+  }
 }
 
 // Clear the histogram data but keep the bounds
@@ -397,7 +510,8 @@ template <class T>
 double MH1<T>::GetMaxWeight() const {
   double maxval = 0;
   for (std::size_t i = 0; i < static_cast<unsigned int>(XBINS); ++i) {
-    if (GetPositiveDefinite(i) > maxval) { maxval = GetPositiveDefinite(i); }
+    const double value = GetPositiveDefinite(i);  // evaluate |w| once per bin
+    if (value > maxval) { maxval = value; }
   }
   return maxval;
 }
@@ -407,7 +521,8 @@ template <class T>
 double MH1<T>::GetMinWeight() const {
   double minval = 1e128;
   for (std::size_t i = 0; i < static_cast<unsigned int>(XBINS); ++i) {
-    if (GetPositiveDefinite(i) < minval) { minval = GetPositiveDefinite(i); }
+    const double value = GetPositiveDefinite(i);  // evaluate |w| once per bin
+    if (value < minval) { minval = value; }
   }
   return minval;
 }
@@ -496,24 +611,21 @@ template <class T>
 double MH1<T>::GetPositiveDefinite(int idx) const {
   if (ValidBin(idx)) {
     if (IsReal()) { return std::abs(weights[idx]); }
-    return std::pow(std::abs(weights[idx]), 2);
+    return std::norm(weights[idx]);
   } else {
     return 0.0;
   }
 }
 
 
-// Get bin index (idx) corresponding to value (xvalue)
+// Get bin index corresponding to value (xvalue)
 template <class T>
-void MH1<T>::GetBinIdx(double xvalue, int &idx) {
+int MH1<T>::GetBinIdx(double xvalue) const {
   // Equal width binning
-  if (binedges.empty()) {
-    idx = ComputeIdx(xvalue, XMIN, XMAX, XBINS, LOGX);
+  if (binedges.empty()) { return ComputeIdx(xvalue, XMIN, XMAX, XBINS, LOGX); }
 
-    // Variable width binning
-  } else {
-    idx = ComputeIdx(xvalue, binedges);
-  }
+  // Variable width binning
+  return ComputeIdx(xvalue, binedges);
 }
 
 // Get bin value in units of X for a given bin index
@@ -532,31 +644,15 @@ double MH1<T>::GetBinXVal(int idx, int boundary) const {
     throw std::invalid_argument("MH1::GetBinXVal: idx = " + std::to_string(idx) +
                                 " > XBINS-1 = " + std::to_string(XBINS - 1));
   }
-  if (LOGX) {
-    const double log10step = (std::log10(XMAX) - std::log10(XMIN)) / XBINS;
-    if (boundary == -1) {
-      return std::pow(10, std::log10(XMIN) + idx * log10step);
-    } else if (boundary == 0) {
-      return (std::pow(10, std::log10(XMIN) + idx * log10step) +
-              std::pow(10, std::log10(XMIN) + (idx + 1) * log10step)) /
-             2;
-    } else if (boundary == 1) {
-      return std::pow(10, std::log10(XMIN) + (idx + 1) * log10step);
-    } else {
-      throw std::invalid_argument("MH1::GetBinXVal: Bin boundary not valid (-1,0,1)");
-    }
+  // Cached geometry from BuildBinCache
+  if (boundary == -1) {
+    return bin_lo_[idx];
+  } else if (boundary == 0) {
+    return bin_center_[idx];
+  } else if (boundary == 1) {
+    return bin_hi_[idx];
   } else {
-    const double binwidth = (XMAX - XMIN) / XBINS;
-    const double value    = XMIN + (idx + 1) * binwidth;
-    if (boundary == -1) {
-      return value - binwidth;
-    } else if (boundary == 0) {
-      return value - binwidth / 2.0;
-    } else if (boundary == 1) {
-      return value;
-    } else {
-      throw std::invalid_argument("MH1::GetBinXVal: Bin boundary not valid (-1,0,1)");
-    }
+    throw std::invalid_argument("MH1::GetBinXVal: Bin boundary not valid (-1,0,1)");
   }
 }
 
@@ -577,14 +673,13 @@ int MH1<T>::ComputeIdx(double value, const std::vector<std::vector<double>> &edg
   }
   // Binary search
   else {
-    /*
-    // Linear search
-    for (std::size_t i = 0; i < binedges.size(); ++i) {
-      if (binedges[i][0] < xvalue && xvalue <= binedges[i][1]) {
-        idx = i;
-      }
+    // Contiguous bins: search the flat edge array (single cache-hot
+    // stream of doubles instead of pointer chasing vector-of-vectors)
+    if (edges_contiguous_ && !edges_flat_.empty()) {
+      const auto it  = std::lower_bound(edges_flat_.begin(), edges_flat_.end(), value);
+      const int  idx = static_cast<int>(it - edges_flat_.begin()) - 1;
+      return (idx < 0) ? 0 : idx;  // value at the lowest edge -> first bin
     }
-    */
     // Binary search via STL library
     const auto it = std::upper_bound(edges.begin(), edges.end(), value, compare_bin_edges());
     return (it != edges.end()) ? it - edges.begin() : -3;  // -3 happens only if hole
@@ -609,16 +704,13 @@ int MH1<T>::ComputeIdx(double value, double minval, double maxval, int nbins, bo
   if (value > maxval) { return -2; }  // overflow
 
   int idx = 0;
-  // Logarithmic binning
+  // Logarithmic binning (reciprocal log-width cached in ResetBounds)
   if (logbins) {
     // Check do we have non-negative input
-    idx = value > 0 ? std::floor(nbins * (std::log10(value) - std::log10(minval)) /
-                                 (std::log10(maxval) - std::log10(minval)))
-                    : -1;
-    // Linear binning
+    idx = value > 0 ? std::floor((std::log10(value) - log10_xmin_) * inv_log10_dx_) : -1;
+    // Linear binning (reciprocal width cached in ResetBounds)
   } else {
-    const double BINWIDTH = (maxval - minval) / nbins;
-    idx                   = std::floor((value - minval) / BINWIDTH);
+    idx = std::floor((value - minval) * inv_dx_);
   }
   return idx;
 }
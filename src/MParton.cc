@@ -50,10 +50,6 @@ MParton::MParton(std::string process, const std::vector<aux::OneCMD> &syntax) {
   InitHistograms();
   SetProcess(process, syntax);
 
-  // Init final states
-  M4Vec zerovec(0, 0, 0, 0);
-  for (std::size_t i = 0; i < 10; ++i) { lts.pfinal.push_back(zerovec); }
-
   std::cout << "MParton:: [Constructor done]" << std::endl;
 }
 
@@ -87,6 +83,9 @@ void MParton::post_Constructor() {
   // Not applicable here
   // if (EXCITATION == 1) { ProcPtr.LIPSDIM += 1; }
   // if (EXCITATION == 2) { ProcPtr.LIPSDIM += 2; }
+
+  // Active final state slots: central system + 2 forward legs + decay legs
+  lts.pfinal_n = lts.decaytree.size() + 3;
 }
 
 // No screening loop kinematics considered here
@@ -95,7 +94,7 @@ bool MParton::LoopKinematics(const std::vector<double> &p1p, const std::vector<d
 }
 
 // Return Monte Carlo integrand weight
-double MParton::EventWeight(const std::vector<double> &randvec, AuxIntData &aux) {
+double MParton::EventWeight(std::span<const double> randvec, AuxIntData &aux) {
   double W = 0.0;
 
   // Kinematics and cuts
@@ -133,10 +132,11 @@ double MParton::EventWeight(const std::vector<double> &randvec, AuxIntData &aux)
 
   aux.amplitude_ok = CheckInfNan(W);
 
-  // As the last STEP: Histograms
+  // As the last STEP: Histograms. Zero-weight (rejected) events carry no
+  // information and may hold invalid kinematics, skip the fill overhead
   // if (!aux.burn_in_mode) {
   const double totalweight = W * aux.vegasweight;
-  FillHistograms(totalweight, lts);
+  if (totalweight != 0.0) { FillHistograms(totalweight, lts); }
   //}
 
   return W;
@@ -192,25 +192,34 @@ void MParton::PrintInit(bool silent) const {
 }
 
 // 2-dimensional phase space vector initialization
-bool MParton::B2RandomKin(const std::vector<double> &randvec) {
+bool MParton::B2RandomKin(std::span<const double> randvec) {
   double x1 = randvec[0];
   double x2 = randvec[1];
 
+  // Invariant over the trial loop below
+  const double x1x2s = x1 * x2 * lts.s;
+
   const unsigned int MAXTRIAL = 1e4;
   unsigned int       trials   = 0;
   while (true) {
-    double M_sum = 0.0;
+    double M_sum      = 0.0;
+    bool   stochastic = false;
 
     // Pick daughter masses
     // ==============================================================
     for (const auto &i : indices(lts.decaytree)) {
       GetOffShellMass(lts.decaytree[i], lts.decaytree[i].m_offshell);
       M_sum += lts.decaytree[i].m_offshell;
+      // Zero-width daughters get a fixed mass (cf. GetOffShellMass)
+      stochastic = stochastic || (lts.decaytree[i].p.width >= 1e-40);
     }
     // ==============================================================
 
-    if (x1 * x2 * lts.s > pow2(M_sum)) { break; }  // kinematics possible
+    if (x1x2s > pow2(M_sum)) { break; }  // kinematics possible
 
+    if (!stochastic) {
+      return false;  // Fixed daughter masses cannot change, retrying is futile
+    }
     ++trials;
     if (trials > MAXTRIAL) {
       return false;  // Impossible given daughter masses and this x1 and x2 value
@@ -257,8 +266,11 @@ bool MParton::B2BuildKin(double x1, double x2) {
   // Central system decay tree first branch kinematics set up here, the
   // rest is done recursively
 
-  // Mother mass
+  // Mother mass (sqrt taken once for all phase-space branches)
+  const double MX = lts.pfinal[0].M();
+
   std::vector<double> masses;
+  masses.reserve(lts.decaytree.size());
 
   // Collect decay product masses
   for (const auto &i : indices(lts.decaytree)) {
@@ -274,16 +286,13 @@ bool MParton::B2BuildKin(double x1, double x2) {
   gra::kinematics::MCW w;
   // 2-body
   if (lts.decaytree.size() == 2) {
-    w = gra::kinematics::TwoBodyPhaseSpace(lts.pfinal[0], lts.pfinal[0].M(), masses, products,
-                                           random);
+    w = gra::kinematics::TwoBodyPhaseSpace(lts.pfinal[0], MX, masses, products, random);
     // 3-body
   } else if (lts.decaytree.size() == 3) {
-    w = gra::kinematics::ThreeBodyPhaseSpace(lts.pfinal[0], lts.pfinal[0].M(), masses, products,
-                                             UNWEIGHT, random);
+    w = gra::kinematics::ThreeBodyPhaseSpace(lts.pfinal[0], MX, masses, products, UNWEIGHT, random);
     // N-body
   } else if (lts.decaytree.size() > 3) {
-    w = gra::kinematics::NBodyPhaseSpace(lts.pfinal[0], lts.pfinal[0].M(), masses, products,
-                                         UNWEIGHT, random);
+    w = gra::kinematics::NBodyPhaseSpace(lts.pfinal[0], MX, masses, products, UNWEIGHT, random);
   }
 
   if (w.GetW() < 0) {
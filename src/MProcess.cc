@@ -1121,8 +1121,9 @@ bool MProcess::CommonCuts() const {
     }
 
     // Check system variables
-    if (msqrt(lts.m2) >= fcuts.M_min && msqrt(lts.m2) <= fcuts.M_max && lts.Y >= fcuts.Y_min &&
-        lts.Y <= fcuts.Y_max && lts.Pt >= fcuts.Pt_min && lts.Pt <= fcuts.Pt_max) {
+    const double M = msqrt(lts.m2);
+    if (M >= fcuts.M_min && M <= fcuts.M_max && lts.Y >= fcuts.Y_min && lts.Y <= fcuts.Y_max &&
+        lts.Pt >= fcuts.Pt_min && lts.Pt <= fcuts.Pt_max) {
       // fine, do not touch
     } else {
       return false;  // not fine
@@ -1139,15 +1140,19 @@ bool MProcess::CommonCuts() const {
 void MProcess::FindDecayCuts(const gra::MDecayBranch &branch, bool &ok) const {
   // We are at the end -> must be a final state
   if (branch.legs.size() == 0) {
-    // Check cuts
-    if (branch.p4.Pt() >= fcuts.pt_min && branch.p4.Pt() <= fcuts.pt_max &&
-        branch.p4.Et() >= fcuts.Et_min && branch.p4.Et() <= fcuts.Et_max &&
-        branch.p4.Eta() >= fcuts.eta_min && branch.p4.Eta() <= fcuts.eta_max &&
-        branch.p4.Rap() >= fcuts.rap_min && branch.p4.Rap() <= fcuts.rap_max) {
-      // Event passes cuts
-    } else {
-      ok = false;  // does not pass
-    }
+    // Evaluate each kinematic variable once (Pt/Et/Eta/Rap are computed,
+    // not stored, in M4Vec) and reduce the window comparisons branchless
+    // as a mask AND -- short-circuit chains mispredict heavily at
+    // realistic acceptances
+    const double pt  = branch.p4.Pt();
+    const double Et  = branch.p4.Et();
+    const double eta = branch.p4.Eta();
+    const double rap = branch.p4.Rap();
+
+    const bool pass = (pt >= fcuts.pt_min) & (pt <= fcuts.pt_max) & (Et >= fcuts.Et_min) &
+                      (Et <= fcuts.Et_max) & (eta >= fcuts.eta_min) & (eta <= fcuts.eta_max) &
+                      (rap >= fcuts.rap_min) & (rap <= fcuts.rap_max);
+    ok = ok & pass;
   }
 
   // ** RECURSION here **
@@ -1158,16 +1163,15 @@ void MProcess::FindDecayCuts(const gra::MDecayBranch &branch, bool &ok) const {
 void MProcess::FindVetoCuts(const gra::MDecayBranch &branch, bool &ok) const {
   // We are at the end -> must be a final state
   if (branch.legs.size() == 0) {
-    // Loop over veto domains
+    // Evaluate the kinematic variables once per leg, then test the veto
+    // domains as branchless masks
+    const double pt  = branch.p4.Pt();
+    const double eta = branch.p4.Eta();
+
     for (const auto &i : indices(vetocuts.cuts)) {
-      // Check cuts
-      if (branch.p4.Pt() >= vetocuts.cuts[i].pt_min && branch.p4.Pt() <= vetocuts.cuts[i].pt_max &&
-          branch.p4.Eta() >= vetocuts.cuts[i].eta_min &&
-          branch.p4.Eta() <= vetocuts.cuts[i].eta_max) {
-        ok = false;  // VETO, does not pass
-      } else {
-        // does not trigger veto, do nothing
-      }
+      const bool veto = (pt >= vetocuts.cuts[i].pt_min) & (pt <= vetocuts.cuts[i].pt_max) &
+                        (eta >= vetocuts.cuts[i].eta_min) & (eta <= vetocuts.cuts[i].eta_max);
+      ok = ok & !veto;
     }
   }
 
@@ -1333,25 +1337,14 @@ void MProcess::WriteDecayKinematics(const gra::MDecayBranch &     branch,
 }
 
 // Forward excitation mass sampling
-void MProcess::SampleForwardMasses(std::vector<double> &mvec, const std::vector<double> &randvec) {
+void MProcess::SampleForwardMasses(std::vector<double> &mvec, std::span<const double> randvec) {
   mvec = {lts.beam1.mass, lts.beam2.mass};
 
   lts.excite1 = false;
   lts.excite2 = false;
 
   if (EXCITATION != 0) {
-    M2_f_min = pow2(1.09);  // neutron + pi+ threshold
-    M2_f_max = gcuts.XI_max * lts.s;
-
-    log_M2_f_min = std::log(M2_f_min);
-    log_M2_f_max = std::log(M2_f_max);
-
-    if (M2_f_max <= M2_f_min) {
-      throw std::invalid_argument(
-          "MProcess::SampleForwardMasses: Forward leg Xi : [max = " + std::to_string(gcuts.XI_max) +
-          "] gives mass = " + std::to_string(msqrt(M2_f_max)) +
-          " GeV, below the inelastic threshold. Increase the upper (max) bound.");
-    }
+    // Mass^2 window endpoints folded in SetTechnicalBoundaries
 
     if (EXCITATION == 1) {  // Single
 
@@ -1402,6 +1395,24 @@ void MProcess::SetTechnicalBoundaries(gra::GENCUT &gcuts, unsigned int EXCITATIO
       gcuts.forward_pt_max = 100.0;
     }
   }
+
+  // Forward excitation mass^2 window depends only on the Xi cut and s:
+  // fold the endpoints and their logs here, once, instead of per event in
+  // SampleForwardMasses
+  if (EXCITATION != 0) {
+    M2_f_min = pow2(1.09);  // neutron + pi+ threshold
+    M2_f_max = gcuts.XI_max * lts.s;
+
+    if (M2_f_max <= M2_f_min) {
+      throw std::invalid_argument(
+          "MProcess::SetTechnicalBoundaries: Forward leg Xi : [max = " +
+          std::to_string(gcuts.XI_max) + "] gives mass = " + std::to_string(msqrt(M2_f_max)) +
+          " GeV, below the inelastic threshold. Increase the upper (max) bound.");
+    }
+
+    log_M2_f_min = std::log(M2_f_min);
+    log_M2_f_max = std::log(M2_f_max);
+  }
 }
 
 
@@ -1515,7 +1526,7 @@ void MProcess::PrintFiducialCuts() const {
 
 // Build and check Lorentz scalars
 // Input as the number of final states
-bool MProcess::GetLorentzScalars(unsigned int Nf) {
+bool MProcess::GetLorentzScalars(unsigned int Nf, bool central_fixed) {
   // Example Nf = 4 gives 8 Lorentz scalars:
   //
   //        t1
@@ -1533,8 +1544,12 @@ bool MProcess::GetLorentzScalars(unsigned int Nf) {
   // s-type Lorentz scalars -->
   const int offset = 3;  // central system indexing starts from offset
 
+  // Rows i >= offset pair central decay products only; with central_fixed
+  // those invariants (and their mirrors) are still valid from the full pass
+  const std::size_t imax = central_fixed ? offset : Nf + 1;
+
   // Upper right triangle
-  for (std::size_t i = 0; i <= Nf; ++i) {  // start at 0
+  for (std::size_t i = 0; i < imax; ++i) {  // start at 0
     for (std::size_t j = 0; j <= Nf; ++j) {
       if (i < j) { lts.ss[i][j] = (lts.pfinal[i] + lts.pfinal[j]).M2(); }
       if (lts.ss[i][j] < 0) { return false; }
@@ -1542,7 +1557,7 @@ bool MProcess::GetLorentzScalars(unsigned int Nf) {
   }
   // Copy the i<->j permutated to the left bottom triangle
   // (faster than calculating twice)
-  for (std::size_t i = 0; i <= Nf; ++i) {  // start at 0
+  for (std::size_t i = 0; i < imax; ++i) {  // start at 0
     for (std::size_t j = i; j <= Nf; ++j) {
       if (i != j) { lts.ss[j][i] = lts.ss[i][j]; }
     }
@@ -1829,7 +1844,7 @@ void MProcess::SetProcess(std::string &str, const std::vector<aux::OneCMD> &synt
   ProcPtr.Initialize(istate, channel);
 
   // Check do we find the process
-  if (ProcPtr.Processes.count(str)) {
+  if (ProcPtr.ProcessExist(str)) {
     // fine
   } else {
     throw std::invalid_argument("MProcess::SetProcess: Unknown PROCESS: " + str);
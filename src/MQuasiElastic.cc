@@ -43,10 +43,6 @@ MQuasiElastic::MQuasiElastic(std::string process, const std::vector<aux::OneCMD>
   InitHistograms();
   SetProcess(process, syntax);
 
-  // Init final states
-  M4Vec zerovec(0, 0, 0, 0);
-  for (std::size_t i = 0; i < 10; ++i) { lts.pfinal.push_back(zerovec); }
-
   // Pomeron weights
   MAXPOMW = std::vector<double>(100, 0.0);
   std::cout << "MQuasiElastic:: [Constructor done]" << std::endl;
@@ -70,6 +66,9 @@ void MQuasiElastic::post_Constructor() {
   if (ProcPtr.CHANNEL == "ND") { ProcPtr.LIPSDIM = 1; };  // Keep it 1
 
   Eikonal.Numerics.MaxLoopKT = 3.0;
+
+  // Active final state slots: system slot + 2 forward legs
+  lts.pfinal_n = 3;
 }
 
 // Fiducial user cuts
@@ -157,7 +156,7 @@ bool MQuasiElastic::LoopKinematics(const std::vector<double> &p1p, const std::ve
 }
 
 // Get weight
-double MQuasiElastic::EventWeight(const std::vector<double> &randvec, AuxIntData &aux) {
+double MQuasiElastic::EventWeight(std::span<const double> randvec, AuxIntData &aux) {
   double W = 0.0;
 
   if (ProcPtr.CHANNEL != "ND") {  // Diffractive
@@ -509,7 +508,7 @@ void MQuasiElastic::PrintInit(bool silent) const {
 // needed
 // <=> Rivet analysis.
 //
-std::complex<double> MQuasiElastic::PolySoft(const std::vector<double> &randvec) {
+std::complex<double> MQuasiElastic::PolySoft(std::span<const double> randvec) {
   // Boundary conditions
   const double XMIN = 1e-6;
   const double XMAX = 1.0;
@@ -690,7 +689,7 @@ std::complex<double> MQuasiElastic::PolySoft(const std::vector<double> &randvec)
 // 3-dimensional phase space vector initialization
 // The adaptive phase space boundaries here are taken into account by
 // B3IntegralVolume() function.
-bool MQuasiElastic::B3RandomKin(const std::vector<double> &randvec) {
+bool MQuasiElastic::B3RandomKin(std::span<const double> randvec) {
   // Elastic case: s1 = s3, s2 = s4
   double s3 = lts.pbeam1.M2();
   double s4 = lts.pbeam2.M2();
@@ -5,6 +5,7 @@
 
 // C++
 #include <complex>
+#include <mutex>
 #include <random>
 #include <vector>
 
@@ -35,21 +36,19 @@ namespace gra {
 
 // Class constructor
 MRegge::MRegge(gra::LORENTZSCALAR &lts, const std::string &modelfile) {
-  gra::g_mutex.lock();
-  try {
-    // Global Regge parameter initialization
-    if (!PARAM_REGGE::initialized && lts.decaytree.size() != 0) {
+  // @@ MULTITHREADING: the global Regge parameters are read exactly once;
+  // after that call_once reduces to a flag load, so concurrent worker
+  // constructions no longer serialize on g_mutex. An exception re-arms
+  // the flag, and a parse failure still propagates to the caller.
+  // PARAM_REGGE::initialized is kept, since MTensorPomeron may have
+  // initialized the parameters already
+  static std::once_flag regge_once;
+  if (!PARAM_REGGE::initialized && lts.decaytree.size() != 0) {
+    std::call_once(regge_once, [&]() {
       const int PDG = std::abs(lts.decaytree[0].p.pdg);
       PARAM_REGGE::ReadParameters(PDG, modelfile);
-    }
-    // Class local initialization
-    // ...
-
-  } catch (...) {
-    gra::g_mutex.unlock();  // need to release here, otherwise get infinite lock
-    throw;
+    });
   }
-  gra::g_mutex.unlock();
 }
 
 
@@ -195,27 +194,39 @@ std::complex<double> MRegge::ME2(gra::LORENTZSCALAR &lts, int mode) const {
 // [arxiv.org/abs/1406.7010]
 //
 std::complex<double> MRegge::ME3HEL(gra::LORENTZSCALAR &lts, gra::PARAM_RES &resonance) const {
+  return msqrt(ME3HEL2(lts, resonance));  // we expect amplitude
+}
+
+// Spin-averaged squared helicity amplitude (also fills lts.hamp); lets
+// the cross section caller consume |A|^2 without a sqrt-then-square trip
+double MRegge::ME3HEL2(gra::LORENTZSCALAR &lts, gra::PARAM_RES &resonance) const {
   const int J = resonance.p.spinX2 / 2.0;
 
   // --------------------------------------------------------------------------
-  unsigned int       number = 0;
-  const unsigned int N      = 16 * (2 * J + 1);
-
-  // C++11 quarantees a local static variable initialization thread safety!
-  static std::vector<std::vector<double>> lambda(N, std::vector<double>(5));
-
-  for (double i = 0; i < 2; ++i) {                    // Proton 1
-    for (double j = 0; j < 2; ++j) {                  // Proton 2
-      for (double k = 0; k < 2; ++k) {                // Proton 3
-        for (double l = 0; l < 2; ++l) {              // Proton 4
-          for (double m = 0; m < (2 * J + 1); ++m) {  // Central Boson
-
-            lambda[number] = {i - 0.5, j - 0.5, k - 0.5, l - 0.5, m - static_cast<double>(J)};
-            ++number;
+  const unsigned int N = 16 * (2 * J + 1);
+
+  // Enumerate helicity combinations as doubled (half-)integers, only when
+  // J differs from the previous call (each thread owns its process copy)
+  if (J != hel_lambda_J_) {
+    hel_lambda_.assign(N, {0, 0, 0, 0, 0});
+
+    unsigned int number = 0;
+    for (int i = 0; i < 2; ++i) {                    // Proton 1
+      for (int j = 0; j < 2; ++j) {                  // Proton 2
+        for (int k = 0; k < 2; ++k) {                // Proton 3
+          for (int l = 0; l < 2; ++l) {              // Proton 4
+            for (int m = 0; m < (2 * J + 1); ++m) {  // Central Boson
+
+              hel_lambda_[number] = {static_cast<int8_t>(2 * i - 1), static_cast<int8_t>(2 * j - 1),
+                                     static_cast<int8_t>(2 * k - 1), static_cast<int8_t>(2 * l - 1),
+                                     static_cast<int8_t>(2 * (m - J))};
+              ++number;
+            }
           }
         }
       }
     }
+    hel_lambda_J_ = J;
   }
 
   // --------------------------------------------------------------------------
@@ -237,46 +248,52 @@ std::complex<double> MRegge::ME3HEL(gra::LORENTZSCALAR &lts, gra::PARAM_RES &res
   // Common factor all amplitudes
   std::complex<double> common =
       FF_A * PropOnly(lts.s1, lts.t1) * CBW(lts, resonance) * resonance.g *
-      PARAM_REGGE::ResonanceFormFactor(lts.m2, pow2(resonance.p.mass), resonance.g_FF) *
+      PARAM_REGGE::ResonanceFormFactor(lts.m2, resonance) *
       PropOnly(lts.s2, lts.t2) * FF_B;
 
+  // gik_Vertex depends only on lambda_h inside the helicity loop below:
+  // 2J+1 distinct values versus N = 16(2J+1) iterations, so evaluate the
+  // m1-sum (with its exp/pow transcendentals) once per value here
+  std::vector<std::complex<double>> gik_cache(2 * J + 1);
+  for (int m = -J; m <= J; ++m) {
+    gik_cache[m + J] = gik_Vertex(lts.t1, lts.t2, dphi, m, J, resonance.p.P, resonance.JMAX);
+  }
+
   lts.hamp.clear();
+  lts.hamp.reserve(N);
+
+  // 1/4 {|H1|^2 + |H2|^2 + ... + |HN|^2}, accumulated while filling hamp
+  double amp2 = 0.0;
+
   for (std::size_t i = 0; i < N; ++i) {
-    // Apply upper vertex helicity conservation
-    if (g_Vertex(lts.t1, lambda[i][0], lambda[i][2]) !=
-        std::pow(-1, lambda[i][0] - lambda[i][2]) * g_Vertex(lts.t1, lambda[i][0], lambda[i][2])) {
-      continue;
-    }
-    // Apply lower vertex helicity conservation
-    if (g_Vertex(lts.t2, lambda[i][1], lambda[i][3]) !=
-        std::pow(-1, lambda[i][1] - lambda[i][3]) *
-            g_Vertex(lts.t2, -lambda[i][1], -lambda[i][3])) {
-      continue;
-    }
+    // Recover the physical (half-integer) helicities
+    const double lambda1 = hel_lambda_[i][0] * 0.5;
+    const double lambda3 = hel_lambda_[i][2] * 0.5;
+    const int    lambdah = hel_lambda_[i][4] / 2;
+
+    // Apply upper and lower vertex helicity conservation. g_Vertex depends
+    // only on |lambda_i - lambda_f|, so the sign test g != (-1)^(dlambda) g
+    // reduces to requiring equal helicities (the flip amplitude sqrt(-t)
+    // vanishes only on the t = 0 boundary)
+    if (hel_lambda_[i][0] != hel_lambda_[i][2]) { continue; }
+    if (hel_lambda_[i][1] != hel_lambda_[i][3]) { continue; }
 
     // Spin density matrix weight for this helicity
-    const int                  index = lambda[i][4] + resonance.p.spinX2;  // Index the diagonal
+    const int                  index = lambdah + resonance.p.spinX2;  // Index the diagonal
     const std::complex<double> rhoweight =
         resonance.p.spinX2 != 0 ? resonance.rho[index][index] : 1.0;
 
     // Calculate amplitude
     const std::complex<double> amp =
-        rhoweight * g_Vertex(lts.t1, lambda[i][0], lambda[i][2]) *
-        gik_Vertex(lts.t1, lts.t2, dphi, lambda[i][4], resonance.p.spinX2 / 2.0, resonance.p.P,
-                   resonance.JMAX) *
-        common;
-    g_Vertex(lts.t2, lambda[i][1], lambda[i][3]);
+        rhoweight * g_Vertex(lts.t1, lambda1, lambda3) * gik_cache[lambdah + J] * common;
 
     // std::cout << amp << " :: " << gra::math::abs2(amp) << std::endl;
     lts.hamp.push_back(amp);
+    amp2 += gra::math::abs2(amp);
   }
-
-  // 1/4 {|H1|^2 + |H2|^2 + ... + |HN|^2}
-  double amp2 = 0.0;
-  for (std::size_t i = 0; i < lts.hamp.size(); ++i) { amp2 += gra::math::abs2(lts.hamp[i]); }
   amp2 /= 4;  // Initial state average
 
-  return msqrt(amp2);  // we expect amplitude
+  return amp2;
 }
 
 // This function is used for parity conservation check:
@@ -290,7 +307,8 @@ std::complex<double> MRegge::ME3HEL(gra::LORENTZSCALAR &lts, gra::PARAM_RES &res
 // "Naturality" \def= Reggeon Parity x Reggeon Regge Signature
 //
 int MRegge::xi3(int J, int P, int P_i, int sigma_i, int P_k, int sigma_k) const {
-  return P * std::pow(-1, J) * P_i * sigma_i * P_k * sigma_k;
+  // (-1)^J from the integer parity, no std::pow needed
+  return P * ((J % 2 == 0) ? 1 : -1) * P_i * sigma_i * P_k * sigma_k;
 }
 
 // --------------------------------------------------------------------------------------
@@ -308,8 +326,20 @@ int MRegge::xi3(int J, int P, int P_i, int sigma_i, int P_k, int sigma_k) const
 // g_{-\lambda_1-\lambda_3}(t)
 // \xi_1 = \eta_1\eta_3 (-1)^{S_1 - S_3} P_i \sigma_i
 //
+namespace {
+// x^{n/2} for the small half-integer helicity-vertex exponents
+// (n = |helicity difference|, typically 0, 1 or 2), avoiding the
+// generic log/exp path of std::pow in the helicity loops
+inline double HalfIntPow(double x, double n) {
+  if (n == 0.0) { return 1.0; }
+  if (n == 1.0) { return std::sqrt(x); }
+  if (n == 2.0) { return x; }
+  return std::pow(x, n / 2);
+}
+}  // namespace
+
 double MRegge::g_Vertex(double t, double lambda_i, double lambda_f) const {
-  return std::pow(-t, std::abs(lambda_i - lambda_f) / 2);
+  return HalfIntPow(-t, std::abs(lambda_i - lambda_f));
 }
 
 // Central vertex subfunction: For small |t1|, |t2|
@@ -319,9 +349,11 @@ double MRegge::g_Vertex(double t, double lambda_i, double lambda_f) const {
 // 2. parity conservation
 //
 double MRegge::gammaLambda(double t1, double t2, double m1, double m2) const {
-  // Parity sign flip under (m1,m2) <-> (-m1,-m2)
-  const int P = std::pow(-1, math::sign(m1 - std::abs(m1)) * math::sign(m2 - std::abs(m2)));
-  return P * std::pow(-t1, std::abs(m1) / 2) * std::pow(-t2, std::abs(m2) / 2);
+  // Parity sign flip under (m1,m2) <-> (-m1,-m2); the exponent is a
+  // product of sign functions, i.e. an integer in {-1,0,1}
+  const int e = static_cast<int>(math::sign(m1 - std::abs(m1)) * math::sign(m2 - std::abs(m2)));
+  const int P = (e % 2 == 0) ? 1 : -1;
+  return P * HalfIntPow(-t1, std::abs(m1)) * HalfIntPow(-t2, std::abs(m2));
 }
 
 // Central vertex g_ik(t1,t2,\phi)^{\lambda_h} (central resonance J, P)
@@ -343,8 +375,11 @@ std::complex<double> MRegge::gik_Vertex(double t1, double t2, double dphi, int l
   const int pom2_P     = 1;  // Pomeron 2 parity +
   const int pom2_sigma = 1;  // Pomeron 2 signature +
 
-  const int            xi3val = xi3(J, P, pom1_P, pom1_sigma, pom2_P, pom2_sigma);
-  std::complex<double> sum    = 0.0;
+  const int xi3val = xi3(J, P, pom1_P, pom1_sigma, pom2_P, pom2_sigma);
+
+  // (-1)^lambda_h x xi3, invariant over the m1 sum
+  const double         xiphase = ((lambda_h % 2 == 0) ? 1.0 : -1.0) * xi3val;
+  std::complex<double> sum     = 0.0;
 
   for (int m1 = -JMAX; m1 <= JMAX; ++m1) {  // -\inf < m_1 < inf
 
@@ -353,7 +388,7 @@ std::complex<double> MRegge::gik_Vertex(double t1, double t2, double dphi, int l
 
     // Parity conservation
     const double gamma_L = gammaLambda(t1, t2, m1, m2);
-    const double gamma_R = std::pow(-1, lambda_h) * xi3val * gammaLambda(t1, t2, -m1, -m2);
+    const double gamma_R = xiphase * gammaLambda(t1, t2, -m1, -m2);
 
     if (math::sign(gamma_L) != math::sign(gamma_R)) continue;
 
@@ -413,28 +448,42 @@ std::complex<double> MRegge::ME4(gra::LORENTZSCALAR &lts, double sign) const {
   PomPomProtonVertex(lts, FF_A, FF_B);
 
 
+  // Off-shell form factors and propagators do not depend on the exchange
+  // index, evaluate them once before the loop
+  const double ff_t   = (*ff)(lts.t_hat, M2_);
+  const double prop_t = (*prop)(lts.t_hat, M2_);
+  const double ff_u   = (*ff)(lts.u_hat, M2_);
+  const double prop_u = (*prop)(lts.u_hat, M2_);
+
   // Loop over different exchanges (Pomeron, Reggeons ...)
   std::complex<double> A(0, 0);
 
-  for (std::size_t k = 0; k < PARAM_REGGE::active.size(); ++k) {
+  for (const int k : PARAM_REGGE::active_idx) {
     // Particle-Particle-Pomeron( or Reggon) coupling
-    if (PARAM_REGGE::active[k]) {
-      const double gpp_P = PARAM_REGGE::c[k] / PARAM_SOFT::gN_P;  // Coupling
-
-      const std::complex<double> A_t = PropOnly(lts.ss[1][3], lts.t1, k) * FF_A *
-                                       (*ff)(lts.t_hat, M2_) * gpp_P * prop(lts.t_hat, M2_) *
-                                       (*ff)(lts.t_hat, M2_) * gpp_P *
-                                       PropOnly(lts.ss[2][4], lts.t2, k) * FF_B;
-
-      // sign applied here
-      const std::complex<double> A_u = sign * PropOnly(lts.ss[1][4], lts.t1, k) * FF_A *
-                                       (*ff)(lts.u_hat, M2_) * gpp_P * prop(lts.u_hat, M2_) *
-                                       (*ff)(lts.u_hat, M2_) * gpp_P *
-                                       PropOnly(lts.ss[2][3], lts.t2, k) * FF_B;
-
-      // Total sub-amplitude
-      A += (A_t + A_u);
-    }
+    const double gpp_P = PARAM_REGGE::c[k] / PARAM_SOFT::gN_P;  // Coupling
+
+    // The t- and u-channel orderings share the signature factor and
+    // trajectory per beam side, evaluate each side as one batch of two
+    double       re[2] = {0.0}, im[2] = {0.0};
+    const double s1v[2] = {lts.ss[1][3], lts.ss[1][4]};
+    PropOnlyBatch(s1v, 2, lts.t1, k, re, im);
+    const std::complex<double> prop13(re[0], im[0]);
+    const std::complex<double> prop14(re[1], im[1]);
+
+    const double s2v[2] = {lts.ss[2][4], lts.ss[2][3]};
+    PropOnlyBatch(s2v, 2, lts.t2, k, re, im);
+    const std::complex<double> prop24(re[0], im[0]);
+    const std::complex<double> prop23(re[1], im[1]);
+
+    const std::complex<double> A_t =
+        prop13 * FF_A * ff_t * gpp_P * prop_t * ff_t * gpp_P * prop24 * FF_B;
+
+    // sign applied here
+    const std::complex<double> A_u =
+        sign * prop14 * FF_A * ff_u * gpp_P * prop_u * ff_u * gpp_P * prop23 * FF_B;
+
+    // Total sub-amplitude
+    A += (A_t + A_u);
   }
 
   // --------------------------------------------------------------------
@@ -476,10 +525,16 @@ std::complex<double> MRegge::ME4(gra::LORENTZSCALAR &lts, double sign) const {
 //
 //
 std::complex<double> MRegge::ME6(gra::LORENTZSCALAR &lts) {
-  // Construct 4-body Regge Ladder leg combinatorial permutations
-  if (permutations4.size() == 0) {
-    permutations4 = gra::math::GetAmpPerm(4, PARAM_REGGE::ampcombs);
-  }
+  // 4-body Regge Ladder leg combinatorial permutations (flattened), built
+  // once on first use (thread-safe static initialization); ampcombs is
+  // fixed after PARAM_REGGE::ReadParameters
+  static const std::vector<int> permutations4 = [] {
+    std::vector<int> flat;
+    for (const auto &row : gra::math::GetAmpPerm(4, PARAM_REGGE::ampcombs)) {
+      flat.insert(flat.end(), row.begin(), row.end());
+    }
+    return flat;
+  }();
 
   // Amplitude_
   std::complex<double> A(0, 0);
@@ -512,12 +567,53 @@ std::complex<double> MRegge::ME6(gra::LORENTZSCALAR &lts) {
   // Particle-Particle-Pomeron coupling
   const double gpp_P = PARAM_REGGE::c[0] / PARAM_SOFT::gN_P;
 
+  // Leg propagators depend only on (leg, t1) / (leg, t2): evaluate each one
+  // once per event here, instead of re-doing the complex pow inside every
+  // permutation (Kf evaluations instead of #permutations)
+  const unsigned int                offset = 3;  // leg indexing
+  const std::size_t                 Kf     = lts.decaytree.size();
+  std::vector<std::complex<double>> prop1(Kf);
+  std::vector<std::complex<double>> prop2(Kf);
+  {
+    // Batched evaluation: eta(t) / alpha(t) hoisted once per side
+    std::vector<double> sv(Kf), re(Kf), im(Kf);
+    for (std::size_t j = 0; j < Kf; ++j) { sv[j] = lts.ss[1][j + offset]; }
+    PropOnlyBatch(sv.data(), Kf, lts.t1, 0, re.data(), im.data());
+    for (std::size_t j = 0; j < Kf; ++j) { prop1[j] = {re[j], im[j]}; }
+
+    for (std::size_t j = 0; j < Kf; ++j) { sv[j] = lts.ss[2][j + offset]; }
+    PropOnlyBatch(sv.data(), Kf, lts.t2, 0, re.data(), im.data());
+    for (std::size_t j = 0; j < Kf; ++j) { prop2[j] = {re[j], im[j]}; }
+  }
+
+  // Form factor / off-shell propagator values depend only on one or two
+  // leg indices: tabulate once per event, look up inside the permutations
+  std::vector<double> ffA_1(Kf), propA_1(Kf), ffB_2(Kf), propB_2(Kf);
+  for (std::size_t j = 0; j < Kf; ++j) {
+    ffA_1[j]   = (*ff)(lts.tt_1[j + offset], M2_A);
+    propA_1[j] = (*prop)(lts.tt_1[j + offset], M2_A);
+    ffB_2[j]   = (*ff)(lts.tt_2[j + offset], M2_B);
+    propB_2[j] = (*prop)(lts.tt_2[j + offset], M2_B);
+  }
+  std::vector<std::vector<double>> ffxA(Kf, std::vector<double>(Kf, 0.0));
+  std::vector<std::vector<double>> ffxB(Kf, std::vector<double>(Kf, 0.0));
+  for (std::size_t x = 0; x < Kf; ++x) {
+    for (std::size_t y = 0; y < Kf; ++y) {
+      if (x == y) { continue; }
+      const double tt = lts.tt_xy[x + offset][y + offset];
+      ffxA[x][y]      = (*ff)(tt, M2_A);
+      ffxB[x][y]      = (*ff)(tt, M2_B);
+    }
+  }
+
   // Loop over different final state permutations (max #16)
-  for (const auto &i : indices(permutations4)) {
-    const unsigned int a = permutations4[i][0];
-    const unsigned int b = permutations4[i][1];
-    const unsigned int c = permutations4[i][2];
-    const unsigned int d = permutations4[i][3];
+  const std::size_t Nperm4 = permutations4.size() / 4;
+  for (std::size_t i = 0; i < Nperm4; ++i) {
+    const int *        perm = &permutations4[i * 4];
+    const unsigned int a    = perm[0];
+    const unsigned int b    = perm[1];
+    const unsigned int c    = perm[2];
+    const unsigned int d    = perm[3];
 
     // Calculate t-type Lorentz scalars here [no need, done already]
     // const double tt_ab = (pbeam1_pfinal1 - pfinal[a]).M2();
@@ -526,14 +622,13 @@ std::complex<double> MRegge::ME6(gra::LORENTZSCALAR &lts) {
     // const double tt_cd = (pbeam2_pfinal2 - pfinal[d]).M2();
 
     // Get Lorentz scalars
-    const double tt_ab = lts.tt_1[a];
     const double tt_bc = lts.tt_xy[a][b];
-    const double tt_cd = lts.tt_2[d];
 
     const std::complex<double> subamp =
-        PropOnly(lts.ss[1][a], lts.t1) * FF_A * (*ff)(tt_ab, M2_A) * gpp_P * prop(tt_ab, M2_A) *
-        (*ff)(tt_bc, M2_A) * gpp_P * PropOnly(lts.ss[b][c], tt_bc) * (*ff)(tt_bc, M2_B) * gpp_P *
-        prop(tt_cd, M2_B) * (*ff)(tt_cd, M2_B) * gpp_P * PropOnly(lts.ss[2][d], lts.t2) * FF_B;
+        prop1[a - offset] * FF_A * ffA_1[a - offset] * gpp_P * propA_1[a - offset] *
+        ffxA[a - offset][b - offset] * gpp_P * PropOnly(lts.ss[b][c], tt_bc) *
+        ffxB[a - offset][b - offset] * gpp_P * propB_2[d - offset] * ffB_2[d - offset] * gpp_P *
+        prop2[d - offset] * FF_B;
 
     A += subamp;
   }
@@ -571,10 +666,15 @@ std::complex<double> MRegge::ME6(gra::LORENTZSCALAR &lts) {
 //  ======F======>
 //
 std::complex<double> MRegge::ME8(gra::LORENTZSCALAR &lts) {
-  // Construct 6-body Regge Ladder leg combinatorial permutations
-  if (permutations6.size() == 0) {
-    permutations6 = gra::math::GetAmpPerm(6, PARAM_REGGE::ampcombs);
-  }
+  // 6-body Regge Ladder leg combinatorial permutations (flattened), built
+  // once on first use as in ME6
+  static const std::vector<int> permutations6 = [] {
+    std::vector<int> flat;
+    for (const auto &row : gra::math::GetAmpPerm(6, PARAM_REGGE::ampcombs)) {
+      flat.insert(flat.end(), row.begin(), row.end());
+    }
+    return flat;
+  }();
 
   // Amplitude
   std::complex<double> A(0, 0);
@@ -609,14 +709,59 @@ std::complex<double> MRegge::ME8(gra::LORENTZSCALAR &lts) {
   // Particle-Particle-Pomeron coupling
   const double gpp_P = PARAM_REGGE::c[0] / PARAM_SOFT::gN_P;
 
+  // Leg propagators depend only on (leg, t1) / (leg, t2): evaluate each one
+  // once per event, instead of inside all (max #288) permutations
+  const unsigned int                offset = 3;  // leg indexing
+  const std::size_t                 Kf     = lts.decaytree.size();
+  std::vector<std::complex<double>> prop1(Kf);
+  std::vector<std::complex<double>> prop2(Kf);
+  {
+    // Batched evaluation: eta(t) / alpha(t) hoisted once per side
+    std::vector<double> sv(Kf), re(Kf), im(Kf);
+    for (std::size_t j = 0; j < Kf; ++j) { sv[j] = lts.ss[1][j + offset]; }
+    PropOnlyBatch(sv.data(), Kf, lts.t1, 0, re.data(), im.data());
+    for (std::size_t j = 0; j < Kf; ++j) { prop1[j] = {re[j], im[j]}; }
+
+    for (std::size_t j = 0; j < Kf; ++j) { sv[j] = lts.ss[2][j + offset]; }
+    PropOnlyBatch(sv.data(), Kf, lts.t2, 0, re.data(), im.data());
+    for (std::size_t j = 0; j < Kf; ++j) { prop2[j] = {re[j], im[j]}; }
+  }
+
+  // Form factor / off-shell propagator values depend only on one or two
+  // leg indices while the loop below runs up to 288 orderings: tabulate
+  // them once per event, look up inside the permutations
+  std::vector<double> ffA_1(Kf), propA_1(Kf), ffC_2(Kf), propC_2(Kf);
+  for (std::size_t j = 0; j < Kf; ++j) {
+    ffA_1[j]   = (*ff)(lts.tt_1[j + offset], M2_A);
+    propA_1[j] = (*prop)(lts.tt_1[j + offset], M2_A);
+    ffC_2[j]   = (*ff)(lts.tt_2[j + offset], M2_C);
+    propC_2[j] = (*prop)(lts.tt_2[j + offset], M2_C);
+  }
+  std::vector<std::vector<double>> ffxA(Kf, std::vector<double>(Kf, 0.0));
+  std::vector<std::vector<double>> ffxB(Kf, std::vector<double>(Kf, 0.0));
+  std::vector<std::vector<double>> ffxC(Kf, std::vector<double>(Kf, 0.0));
+  std::vector<std::vector<double>> propxB(Kf, std::vector<double>(Kf, 0.0));
+  for (std::size_t x = 0; x < Kf; ++x) {
+    for (std::size_t y = 0; y < Kf; ++y) {
+      if (x == y) { continue; }
+      const double tt = lts.tt_xy[x + offset][y + offset];
+      ffxA[x][y]      = (*ff)(tt, M2_A);
+      ffxB[x][y]      = (*ff)(tt, M2_B);
+      ffxC[x][y]      = (*ff)(tt, M2_C);
+      propxB[x][y]    = (*prop)(tt, M2_B);
+    }
+  }
+
   // Loop over different permutations (max #288)
-  for (const auto &i : indices(permutations6)) {
-    const unsigned int a = permutations6[i][0];
-    const unsigned int b = permutations6[i][1];
-    const unsigned int c = permutations6[i][2];
-    const unsigned int d = permutations6[i][3];
-    const unsigned int e = permutations6[i][4];
-    const unsigned int f = permutations6[i][5];
+  const std::size_t Nperm6 = permutations6.size() / 6;
+  for (std::size_t i = 0; i < Nperm6; ++i) {
+    const int *        perm = &permutations6[i * 6];
+    const unsigned int a    = perm[0];
+    const unsigned int b    = perm[1];
+    const unsigned int c    = perm[2];
+    const unsigned int d    = perm[3];
+    const unsigned int e    = perm[4];
+    const unsigned int f    = perm[5];
 
     // t-type Lorentz scalars [no need here, already calculated]
     // const double tt_ab = (pbeam1_pfinal1 - pfinal[a]).M2();
@@ -626,18 +771,16 @@ std::complex<double> MRegge::ME8(gra::LORENTZSCALAR &lts) {
     // const double tt_ef = (pbeam2_pfinal2 - pfinal[f]).M2();
 
     // Collect scalars
-    const double tt_ab = lts.tt_1[a];
     const double tt_bc = lts.tt_xy[a][b];
-    const double tt_cd = lts.tt_xy[b][c];
     const double tt_de = lts.tt_xy[c][d];
-    const double tt_ef = lts.tt_2[f];
 
     const std::complex<double> subamp =
-        PropOnly(lts.ss[1][a], lts.t1) * FF_A * (*ff)(tt_ab, M2_A) * gpp_P * prop(tt_ab, M2_A) *
-        (*ff)(tt_bc, M2_A) * gpp_P * PropOnly(lts.ss[b][c], tt_bc) * (*ff)(tt_bc, M2_B) * gpp_P *
-        prop(tt_cd, M2_B) * (*ff)(tt_de, M2_B) * gpp_P * PropOnly(lts.ss[d][e], tt_de) *
-        (*ff)(tt_de, M2_C) * gpp_P * prop(tt_ef, M2_C) * (*ff)(tt_ef, M2_C) * gpp_P *
-        PropOnly(lts.ss[2][f], lts.t2) * FF_B;
+        prop1[a - offset] * FF_A * ffA_1[a - offset] * gpp_P * propA_1[a - offset] *
+        ffxA[a - offset][b - offset] * gpp_P * PropOnly(lts.ss[b][c], tt_bc) *
+        ffxB[a - offset][b - offset] * gpp_P * propxB[b - offset][c - offset] *
+        ffxB[c - offset][d - offset] * gpp_P * PropOnly(lts.ss[d][e], tt_de) *
+        ffxC[c - offset][d - offset] * gpp_P * propC_2[f - offset] * ffC_2[f - offset] * gpp_P *
+        prop2[f - offset] * FF_B;
 
     A += subamp;
   }
@@ -653,12 +796,35 @@ std::complex<double> MRegge::ME8(gra::LORENTZSCALAR &lts) {
 // Proton-Proton-Pomeron elastic / inelastic vertex
 //
 void MRegge::PomPomProtonVertex(const gra::LORENTZSCALAR &lts, double &FF_A, double &FF_B) const {
-  FF_A = lts.excite1 ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_P) *
-                           gra::form::S3FINEL(lts.t1, lts.pfinal[1].M2())
-                     : PARAM_SOFT::gN_P * gra::form::S3F(lts.t1);
-  FF_B = lts.excite2 ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_P) *
-                           gra::form::S3FINEL(lts.t2, lts.pfinal[2].M2())
-                     : PARAM_SOFT::gN_P * gra::form::S3F(lts.t2);
+  const double m1sq = lts.pfinal[1].M2();
+  const double m2sq = lts.pfinal[2].M2();
+
+  // Re-use the previous evaluation when every input matches, which is the
+  // common case when several sub-amplitudes (resonances, exchanges) are
+  // evaluated for one event kinematics; S3F/S3FINEL are transcendental-heavy
+  if (!(pppv_valid_ && lts.t1 == pppv_t1_ && lts.t2 == pppv_t2_ && m1sq == pppv_m1sq_ &&
+        m2sq == pppv_m2sq_ && lts.excite1 == pppv_ex1_ && lts.excite2 == pppv_ex2_ &&
+        PARAM_SOFT::gN_P == pppv_gN_ && PARAM_SOFT::g3P == pppv_g3P_)) {
+    pppv_FFA_ = lts.excite1
+                    ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_P) * gra::form::S3FINEL(lts.t1, m1sq)
+                    : PARAM_SOFT::gN_P * gra::form::S3F(lts.t1);
+    pppv_FFB_ = lts.excite2
+                    ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_P) * gra::form::S3FINEL(lts.t2, m2sq)
+                    : PARAM_SOFT::gN_P * gra::form::S3F(lts.t2);
+
+    pppv_t1_    = lts.t1;
+    pppv_t2_    = lts.t2;
+    pppv_m1sq_  = m1sq;
+    pppv_m2sq_  = m2sq;
+    pppv_ex1_   = lts.excite1;
+    pppv_ex2_   = lts.excite2;
+    pppv_gN_    = PARAM_SOFT::gN_P;
+    pppv_g3P_   = PARAM_SOFT::g3P;
+    pppv_valid_ = true;
+  }
+
+  FF_A = pppv_FFA_;
+  FF_B = pppv_FFB_;
 }
 
 // ----------------------------------------------------------------------------
@@ -702,7 +868,7 @@ std::complex<double> MRegge::ME3(gra::LORENTZSCALAR &lts, gra::PARAM_RES &resona
   // Factor 2 x from initial state (identical boson) statistics
   const std::complex<double> A_prod =
       2.0 * PropOnly(lts.s1, lts.t1) * FF_A * CBW(lts, resonance) *
-      PARAM_REGGE::ResonanceFormFactor(lts.m2, pow2(resonance.p.mass), resonance.g_FF) *
+      PARAM_REGGE::ResonanceFormFactor(lts.m2, resonance) *
       PropOnly(lts.s2, lts.t2) * FF_B;
 
   // Production and Decay amplitude
@@ -735,33 +901,31 @@ std::complex<double> MRegge::ME3(gra::LORENTZSCALAR &lts, gra::PARAM_RES &resona
 // ===========
 //
 std::complex<double> MRegge::ME3ODD(gra::LORENTZSCALAR &lts, gra::PARAM_RES &resonance) const {
-  // Proton / Dissociative system vertices
-  double FF_A = lts.excite1 ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_P) *
-                                  gra::form::S3FINEL(lts.t1, lts.pfinal[1].M2())
-                            : PARAM_SOFT::gN_P * gra::form::S3F(lts.t1);
-  double FF_B = lts.excite2 ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_O) *
-                                  gra::form::S3FINEL(lts.t2, lts.pfinal[2].M2())
-                            : PARAM_SOFT::gN_O * gra::form::S3F(lts.t2);
-
-  const std::complex<double> A1 =
-      PropOnly(lts.s1, lts.t1) * FF_A * CBW(lts, resonance) *
-      PARAM_REGGE::ResonanceFormFactor(lts.m2, pow2(resonance.p.mass), resonance.g_FF) *
-      OdderonProp(lts.s2, lts.t2) * FF_B;
+  // Proton / Dissociative system vertices: the S3F/S3FINEL form factor
+  // structure is identical between the P-O and O-P orderings below, only
+  // the couplings swap, so evaluate each form factor once
+  const double S3_1 = lts.excite1 ? gra::form::S3FINEL(lts.t1, lts.pfinal[1].M2())
+                                  : gra::form::S3F(lts.t1);
+  const double S3_2 = lts.excite2 ? gra::form::S3FINEL(lts.t2, lts.pfinal[2].M2())
+                                  : gra::form::S3F(lts.t2);
+
+  const double gP_1 = lts.excite1 ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_P) : PARAM_SOFT::gN_P;
+  const double gO_1 = lts.excite1 ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_O) : PARAM_SOFT::gN_O;
+  const double gP_2 = lts.excite2 ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_P) : PARAM_SOFT::gN_P;
+  const double gO_2 = lts.excite2 ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_O) : PARAM_SOFT::gN_O;
+
+  // Breit-Wigner and resonance form factor are identical between the
+  // orderings, evaluate them once
+  const std::complex<double> cbw = CBW(lts, resonance);
+  const double               rff = PARAM_REGGE::ResonanceFormFactor(lts.m2, resonance);
+
+  const std::complex<double> A1 = PropOnly(lts.s1, lts.t1) * (gP_1 * S3_1) * cbw * rff *
+                                  OdderonProp(lts.s2, lts.t2) * (gO_2 * S3_2);
 
   // ---------------------------------------------------------------------
 
-  // Proton / Dissociative system vertices
-  FF_A = lts.excite1 ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_O) *
-                           gra::form::S3FINEL(lts.t1, lts.pfinal[1].M2())
-                     : PARAM_SOFT::gN_O * gra::form::S3F(lts.t1);
-  FF_B = lts.excite2 ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_P) *
-                           gra::form::S3FINEL(lts.t2, lts.pfinal[2].M2())
-                     : PARAM_SOFT::gN_P * gra::form::S3F(lts.t2);
-
-  const std::complex<double> A2 =
-      OdderonProp(lts.s1, lts.t1) * FF_A * CBW(lts, resonance) *
-      PARAM_REGGE::ResonanceFormFactor(lts.m2, pow2(resonance.p.mass), resonance.g_FF) *
-      PropOnly(lts.s2, lts.t2) * FF_B;
+  const std::complex<double> A2 = OdderonProp(lts.s1, lts.t1) * (gO_1 * S3_1) * cbw * rff *
+                                  PropOnly(lts.s2, lts.t2) * (gP_2 * S3_2);
 
   // ---------------------------------------------------------------------
 
@@ -807,7 +971,7 @@ std::complex<double> MRegge::PhotoME3(gra::LORENTZSCALAR &lts, gra::PARAM_RES &r
   // Resonance part
   const std::complex<double> common =
       CBW(lts, resonance) *
-      PARAM_REGGE::ResonanceFormFactor(lts.m2, pow2(resonance.p.mass), resonance.g_FF);
+      PARAM_REGGE::ResonanceFormFactor(lts.m2, resonance);
 
   double gammaflux1 = lts.excite1 ? IncohFlux(lts.x1, lts.t1, lts.qt1, lts.pfinal[1].M2())
                                   : CohFlux(lts.x1, lts.t1, lts.qt1);
@@ -818,15 +982,16 @@ std::complex<double> MRegge::PhotoME3(gra::LORENTZSCALAR &lts, gra::PARAM_RES &r
   gammaflux1 = msqrt(gammaflux1 / lts.x1);
   gammaflux2 = msqrt(gammaflux2 / lts.x2);
 
+  // Resonance pole mass squared, shared by both orderings
+  const double M2_res = pow2(resonance.p.mass);
+
   // Pomeron up (t1) x Photon down (t2)
   const std::complex<double> A_1 =
-      gammaflux2 * common *
-      PhotoProp(lts.s1, lts.t1, pow2(resonance.p.mass), lts.excite1, lts.pfinal[1].M2());
+      gammaflux2 * common * PhotoProp(lts.s1, lts.t1, M2_res, lts.excite1, lts.pfinal[1].M2());
 
   // Photon up (t1) x Pomeron down (t2)
   const std::complex<double> A_2 =
-      gammaflux1 * common *
-      PhotoProp(lts.s2, lts.t2, pow2(resonance.p.mass), lts.excite2, lts.pfinal[2].M2());
+      gammaflux1 * common * PhotoProp(lts.s2, lts.t2, M2_res, lts.excite2, lts.pfinal[2].M2());
 
   // Should sum here with negative sign if proton-antiproton initial state (anti-symmetric)
   const std::complex<double> A_prod = (lts.beam1.pdg == lts.beam2.pdg) ? (A_1 + A_2) : (A_1 - A_2);
@@ -874,21 +1039,23 @@ std::complex<double> MRegge::PhotoProp(double s, double t, double m2, bool excit
   // data
   // B0 ~ 11 for rho and 4.8 for J/psi, Upsilon
   //
-  // A running slope fit to vector meson / photoproduction slope data
-  const double m_freeze = 0.7;  // GeV, Minimum mass freezing of running
-  const double B0 =
-      std::pow(std::max(pow2(m_freeze), m2) / 2.0, -gra::math::PI / 2.0) + 3 * gra::math::PI / 2.0;
+  // A running slope fit to vector meson / photoproduction slope data,
+  // re-evaluated only when the (per-process constant) mass^2 changes
+  if (m2 != photoB0_m2_) {
+    const double m_freeze = 0.7;  // GeV, Minimum mass freezing of running
+    photoB0_ = std::pow(std::max(pow2(m_freeze), m2) / 2.0, -gra::math::PI / 2.0) +
+               3 * gra::math::PI / 2.0;
+    photoB0_m2_ = m2;
+  }
+  const double B0 = photoB0_;
 
-  // Normalization scale GeV^2
+  // Normalization scale GeV^2: we normalize to W02 = 1, so s/W02 = s below
   // const double W02 = pow2(90.0); // Typical HERA data normalization
-  const double W02 = pow2(1.0);  // We normalize to 1
 
   // N.B. The pomeron slope (a') also affects, so all parameters need
   // to be fitted in a proper way (full MC)
-  const double               alpha    = PARAM_REGGE::a0[0] + PARAM_REGGE::ap[0] * t;
-  const double               alpha_t0 = PARAM_REGGE::a0[0];
-  const double               ap       = PARAM_REGGE::ap[0];
-  const std::complex<double> eta      = ReggeEtaLinear(t, alpha_t0, ap, PARAM_REGGE::sgn[0]);
+  const double               alpha = PARAM_REGGE::a0[0] + PARAM_REGGE::ap[0] * t;
+  const std::complex<double> eta   = SignatureEta(t, 0);
 
   // Proton form factor simply exponential here
   // Division by 2, because we are at amplitude level
@@ -898,7 +1065,29 @@ std::complex<double> MRegge::PhotoProp(double s, double t, double m2, bool excit
       excite ? msqrt(PARAM_SOFT::g3P * PARAM_SOFT::gN_P) * gra::form::S3FINEL(t, M2_forward)
              : PARAM_SOFT::gN_P * std::exp(B0 * t / 2.0);
 
-  return eta * std::pow(s / W02, alpha) * FF;
+  return eta * std::pow(s, alpha) * FF;
+}
+
+// ============================================================================
+// Regge signature factor for linear trajectories
+//
+// The factor splits as eta(alpha(0), sigma) x exp(-i pi/2 alpha' t):
+// the first part depends only on the trajectory constants, so it is
+// cached per trajectory k (for both signature signs, selected by the
+// sign argument) and only the t-dependent rotation is evaluated per call
+std::complex<double> MRegge::SignatureEta(double t, int k, double sign) const {
+  if (eta0_cache_.size() != PARAM_REGGE::a0.size()) {
+    const std::size_t K = PARAM_REGGE::a0.size();
+    eta0_cache_.resize(K);
+    eta0_flip_cache_.resize(K);
+    for (std::size_t j = 0; j < K; ++j) {
+      eta0_cache_[j]      = gra::form::ReggeEta(PARAM_REGGE::a0[j], PARAM_REGGE::sgn[j]);
+      eta0_flip_cache_[j] = gra::form::ReggeEta(PARAM_REGGE::a0[j], -PARAM_REGGE::sgn[j]);
+    }
+  }
+  double s_ = 0.0, c_ = 0.0;
+  gra::math::msincos(-0.5 * gra::math::PI * PARAM_REGGE::ap[k] * t, s_, c_);
+  return (sign > 0 ? eta0_cache_[k] : eta0_flip_cache_[k]) * std::complex<double>(c_, s_);
 }
 
 // ============================================================================
@@ -907,10 +1096,8 @@ std::complex<double> MRegge::PhotoProp(double s, double t, double m2, bool excit
 // k indices which Reggeon (Pomeron)
 std::complex<double> MRegge::PropOnly(double s, double t, int k) const {
   // Trajectory signature
-  const double               alpha    = PARAM_REGGE::a0[k] + PARAM_REGGE::ap[k] * t;
-  const double               alpha_t0 = PARAM_REGGE::a0[k];
-  const double               ap       = PARAM_REGGE::ap[k];
-  const std::complex<double> eta      = ReggeEtaLinear(t, alpha_t0, ap, PARAM_REGGE::sgn[k]);
+  const double               alpha = PARAM_REGGE::a0[k] + PARAM_REGGE::ap[k] * t;
+  const std::complex<double> eta   = SignatureEta(t, k);
 
   // Add to the sum
   const std::complex<double> M = eta * std::pow(s / PARAM_REGGE::s0, alpha);
@@ -918,15 +1105,37 @@ std::complex<double> MRegge::PropOnly(double s, double t, int k) const {
   return M;
 }
 
+// ============================================================================
+// Batched Regge propagators at fixed t (split re/im output)
+//
+// The signature factor eta(t) and the trajectory alpha(t) are shared by
+// the whole batch, so each element costs one real pow instead of a full
+// scalar PropOnly evaluation. Writing plain re/im arrays keeps the loop
+// in auto-vectorizable form, which a loop returning std::complex by
+// value is not.
+void MRegge::PropOnlyBatch(const double *s, std::size_t n, double t, int k, double *re,
+                           double *im) const {
+  const double               alpha = PARAM_REGGE::a0[k] + PARAM_REGGE::ap[k] * t;
+  const std::complex<double> eta   = SignatureEta(t, k);
+
+  const double eta_re = std::real(eta);
+  const double eta_im = std::imag(eta);
+  const double inv_s0 = 1.0 / PARAM_REGGE::s0;
+
+  for (std::size_t j = 0; j < n; ++j) {
+    const double mag = std::pow(s[j] * inv_s0, alpha);
+    re[j]            = eta_re * mag;
+    im[j]            = eta_im * mag;
+  }
+}
+
 // ============================================================================
 // Odderon propagators in the form (s/s0)^alpha(t)
 //
 std::complex<double> MRegge::OdderonProp(double s, double t) const {
-  // Use Pomeron trajectory with odd signature
-  const double               alpha    = PARAM_REGGE::a0[0] + PARAM_REGGE::ap[0] * t;
-  const double               alpha_t0 = PARAM_REGGE::a0[0];
-  const double               ap       = PARAM_REGGE::ap[0];
-  const std::complex<double> eta      = ReggeEtaLinear(t, alpha_t0, ap, (-1) * PARAM_REGGE::sgn[0]);
+  // Use Pomeron trajectory with odd (flipped) signature
+  const double               alpha = PARAM_REGGE::a0[0] + PARAM_REGGE::ap[0] * t;
+  const std::complex<double> eta   = SignatureEta(t, 0, -1.0);
 
   return eta * std::pow(s / PARAM_REGGE::s0, alpha);
 }
@@ -944,8 +1153,9 @@ std::vector<double> sgn;
 
 double s0 = 0.0;
 
-std::string offshellFF = "null";
-double      b_EXP      = 0.0;
+std::string offshellFF      = "null";
+int         offshellFF_mode = -1;
+double      b_EXP           = 0.0;
 double      a_OREAR    = 0.0;
 double      b_OREAR    = 0.0;
 double      b_POW      = 0.0;
@@ -954,8 +1164,9 @@ bool   reggeize = false;
 double omega    = 0.0;
 int    ampcombs = 0;
 
-std::vector<double> c;       // coupling
-std::vector<bool>   active;  // on/off
+std::vector<double> c;           // coupling
+std::vector<bool>   active;      // on/off
+std::vector<int>    active_idx;  // indices of the active exchanges
 
 void PrintParam() {
   std::cout << "PARAM_REGGE:: Sub-amplitude parameters:" << std::endl << std::endl;
@@ -1004,28 +1215,31 @@ void PrintParam() {
 void ReadParameters(int PDG, const std::string &modelfile) {
   // Read and parse
   try {
-    const std::string data = gra::aux::GetInputData(modelfile);
-    nlohmann::json    j    = nlohmann::json::parse(data);
+    const nlohmann::json &j = gra::aux::GetInputJSON(modelfile);
 
     const std::string XID = "PARAM_REGGE";
 
+    // Bind the parameter block once instead of looking it up per key
+    const nlohmann::json &blk = j.at(XID);
+
     // Regge amplitude parameters
-    std::vector<double> a0  = j.at(XID).at("a0");
-    std::vector<double> ap  = j.at(XID).at("ap");
-    std::vector<double> sgn = j.at(XID).at("sgn");
+    std::vector<double> a0  = blk.at("a0");
+    std::vector<double> ap  = blk.at("ap");
+    std::vector<double> sgn = blk.at("sgn");
     PARAM_REGGE::a0         = a0;
     PARAM_REGGE::ap         = ap;
     PARAM_REGGE::sgn        = sgn;
-    PARAM_REGGE::s0         = j.at(XID).at("s0");
+    PARAM_REGGE::s0         = blk.at("s0");
 
-    PARAM_REGGE::offshellFF = j.at(XID).at("offshellFF");
-    PARAM_REGGE::b_EXP      = j.at(XID).at("b_EXP");
-    PARAM_REGGE::a_OREAR    = j.at(XID).at("a_OREAR");
-    PARAM_REGGE::b_OREAR    = j.at(XID).at("b_OREAR");
-    PARAM_REGGE::b_POW      = j.at(XID).at("b_POW");
-    PARAM_REGGE::reggeize   = j.at(XID).at("reggeize");
-    PARAM_REGGE::omega      = j.at(XID).at("omega");
-    PARAM_REGGE::ampcombs   = j.at(XID).at("ampcombs");
+    PARAM_REGGE::offshellFF      = blk.at("offshellFF");
+    PARAM_REGGE::offshellFF_mode = -1;  // re-resolve on next use
+    PARAM_REGGE::b_EXP      = blk.at("b_EXP");
+    PARAM_REGGE::a_OREAR    = blk.at("a_OREAR");
+    PARAM_REGGE::b_OREAR    = blk.at("b_OREAR");
+    PARAM_REGGE::b_POW      = blk.at("b_POW");
+    PARAM_REGGE::reggeize   = blk.at("reggeize");
+    PARAM_REGGE::omega      = blk.at("omega");
+    PARAM_REGGE::ampcombs   = blk.at("ampcombs");
 
 
     // Setup the parameter string
@@ -1047,11 +1261,19 @@ void ReadParameters(int PDG, const std::string &modelfile) {
     }
 
     // Reggeon couplings
-    std::vector<double> c      = j.at(str).at("c");
-    std::vector<bool>   active = j.at(str).at("active");
+    const nlohmann::json &cpl    = j.at(str);
+    std::vector<double>   c      = cpl.at("c");
+    std::vector<bool>     active = cpl.at("active");
     PARAM_REGGE::c             = c;
     PARAM_REGGE::active        = active;
 
+    // Collect the switched-on exchange indices, so the amplitude loops can
+    // iterate over them directly without testing the on/off flags
+    PARAM_REGGE::active_idx.clear();
+    for (std::size_t k = 0; k < active.size(); ++k) {
+      if (active[k]) { PARAM_REGGE::active_idx.push_back(k); }
+    }
+
     PARAM_REGGE::initialized = true;
 
     // PARAM_REGGE::PrintParam();
@@ -1095,7 +1317,7 @@ std::complex<double> JPC_CS_coupling(const gra::LORENTZSCALAR &lts,
   // Naturality
   const double eta1 = 1;                    // Pomeron 1 naturality (parity x signature)
   const double eta2 = 1;                    // Pomeron 2 naturality (parity x signature)
-  const double etaM = P * std::pow(-1, J);  // Central boson naturality
+  const double etaM = P * ((J % 2 == 0) ? 1.0 : -1.0);  // Central boson naturality (-1)^J
   const double eta  = eta1 * eta2 * etaM;
 
   // -------------------------------------------------------------------
@@ -1103,9 +1325,9 @@ std::complex<double> JPC_CS_coupling(const gra::LORENTZSCALAR &lts,
   // Coupling structure (capture local variables with &)
   auto Q = [&]() { return lts.t1 * lts.t2 * pow2(A[PP]) * pow2(std::sin(phi)); };
   auto W = [&]() {
-    const double xi1 = gra::math::csgn(A[PP]) * gra::math::csgn(A[LL]);
-    return pow2(msqrt(lts.t1 * lts.t2) * A[LL] -
-                xi1 * msqrt(lts.t1 * lts.t2) * A[PP] * std::cos(phi));
+    const double xi1    = gra::math::csgn(A[PP]) * gra::math::csgn(A[LL]);
+    const double st1t2  = msqrt(lts.t1 * lts.t2);  // shared by both terms
+    return pow2(st1t2 * A[LL] - xi1 * st1t2 * A[PP] * std::cos(phi));
   };
   auto E = [&]() {
     const double xi2   = gra::math::csgn(A[PL]) * gra::math::csgn(A[LP]);
@@ -1119,54 +1341,56 @@ std::complex<double> JPC_CS_coupling(const gra::LORENTZSCALAR &lts,
 
   const double nabla = 0;
 
-  // Selection rules
-  if (J == 0 && P == -1) {
-    A[LL] = 0;
-    A[PP] = 1;
-    A[PM] = 0;
+  // Selection rules, dispatched on the packed (J, P) pair
+  switch (2 * J + (P == 1 ? 1 : 0)) {
+    case 0:  // J = 0, P = -1
+      A[LL] = 0;
+      A[PP] = 1;
+      A[PM] = 0;
 
-    return msqrt(Q());
-  }
-  if (J == 0 && P == 1) {
-    A[LL] = nabla * delta;
-    A[PP] = 1;
-    A[PM] = 0;
-    return msqrt(W());
-  }
-  if (J == 1 && P == -1) {
-    A[LL] = nabla * D * delta;
-    A[PP] = D;
-    A[PM] = 0;
+      return msqrt(Q());
 
-    return msqrt(Q() + W());
-  }
-  if (J == 1 && P == 1) {
-    A[LL] = 0;
-    A[PP] = D;
-    A[PM] = 0;
+    case 1:  // J = 0, P = +1
+      A[LL] = nabla * delta;
+      A[PP] = 1;
+      A[PM] = 0;
+      return msqrt(W());
 
-    return msqrt(Q() + W());
-  }
-  if (J == 2 && P == -1) {
-    A[LL] = 0;
-    A[PP] = 1;
-    A[PM] = D;
-    A[PL] = msqrt(Q2_2 / lts.m2);
-    A[LP] = msqrt(Q1_2 / lts.m2);
-
-    return msqrt(Q() + E() + R());
-  }
-  if (J == 2 && P == 1) {
-    A[LL] = nabla * delta;
-    A[PP] = 1;
-    A[PM] = 1;
-    A[PL] = msqrt(Q2_2 / lts.m2);
-    A[LP] = msqrt(Q1_2 / lts.m2);
-
-    return msqrt(W() + E() + R());
-  }
+    case 2:  // J = 1, P = -1
+      A[LL] = nabla * D * delta;
+      A[PP] = D;
+      A[PM] = 0;
+
+      return msqrt(Q() + W());
+
+    case 3:  // J = 1, P = +1
+      A[LL] = 0;
+      A[PP] = D;
+      A[PM] = 0;
+
+      return msqrt(Q() + W());
 
-  return 1.0;
+    case 4:  // J = 2, P = -1
+      A[LL] = 0;
+      A[PP] = 1;
+      A[PM] = D;
+      A[PL] = msqrt(Q2_2 / lts.m2);
+      A[LP] = msqrt(Q1_2 / lts.m2);
+
+      return msqrt(Q() + E() + R());
+
+    case 5:  // J = 2, P = +1
+      A[LL] = nabla * delta;
+      A[PP] = 1;
+      A[PM] = 1;
+      A[PL] = msqrt(Q2_2 / lts.m2);
+      A[LP] = msqrt(Q1_2 / lts.m2);
+
+      return msqrt(W() + E() + R());
+
+    default:
+      return 1.0;
+  }
 }
 
 // For data, see:
@@ -1174,60 +1398,50 @@ std::complex<double> JPC_CS_coupling(const gra::LORENTZSCALAR &lts,
 // [REFERENCE: Kirk for WA102, https://arxiv.org/abs/hep-ph/9908253v1]
 
 // Off-Shell meson form factor
-double Meson_FF(double t_hat, double M2) {
-  const double tprime = t_hat - M2;
-
-  if (PARAM_REGGE::offshellFF == "EXP") {
-    return std::exp(-PARAM_REGGE::b_EXP * std::abs(tprime));
-  } else if (PARAM_REGGE::offshellFF == "OREAR") {
-    return std::exp(-PARAM_REGGE::b_OREAR * msqrt(std::abs(tprime) + pow2(PARAM_REGGE::a_OREAR)) +
-                    PARAM_REGGE::a_OREAR * PARAM_REGGE::b_OREAR);
-  } else if (PARAM_REGGE::offshellFF == "POW") {
-    return 1.0 / (1.0 - tprime / PARAM_REGGE::b_POW);
-  } else {
-    throw std::invalid_argument("Meson_FF: Unknown PARAM_REGGE::offshellFF parameter " +
-                                PARAM_REGGE::offshellFF);
+// Resolve the off-shell form factor string to an integer mode once;
+// string comparisons do not belong in the amplitude permutation loops
+// calling the form factors per leg
+static int FFMode() {
+  if (PARAM_REGGE::offshellFF_mode < 0) {
+    if (PARAM_REGGE::offshellFF == "EXP") {
+      PARAM_REGGE::offshellFF_mode = 0;
+    } else if (PARAM_REGGE::offshellFF == "OREAR") {
+      PARAM_REGGE::offshellFF_mode = 1;
+    } else if (PARAM_REGGE::offshellFF == "POW") {
+      PARAM_REGGE::offshellFF_mode = 2;
+    } else {
+      throw std::invalid_argument("PARAM_REGGE::FFMode: Unknown offshellFF parameter " +
+                                  PARAM_REGGE::offshellFF);
+    }
   }
+  return PARAM_REGGE::offshellFF_mode;
 }
 
-// Off-Shell baryon form factor
-double Baryon_FF(double t_hat, double M2) {
-  const double tprime = t_hat - M2;
-
-  if (PARAM_REGGE::offshellFF == "EXP") {
-    return std::exp(-PARAM_REGGE::b_EXP * std::abs(tprime));
-  } else if (PARAM_REGGE::offshellFF == "OREAR") {
-    return std::exp(-PARAM_REGGE::b_OREAR * msqrt(std::abs(tprime) + pow2(PARAM_REGGE::a_OREAR)) +
-                    PARAM_REGGE::a_OREAR * PARAM_REGGE::b_OREAR);
-  } else if (PARAM_REGGE::offshellFF == "POW") {
-    return 1.0 / (1.0 - tprime / PARAM_REGGE::b_POW);
-  } else {
-    throw std::invalid_argument("Baryon_FF: Unknown PARAM_REGGE::offshellFF parameter " +
-                                PARAM_REGGE::offshellFF);
+// Off-shell form factor body shared by the meson and baryon cases
+static double OffShell_FF(double tprime) {
+  switch (FFMode()) {
+    case 0:  // EXP
+      return std::exp(-PARAM_REGGE::b_EXP * std::abs(tprime));
+    case 1:  // OREAR
+      return std::exp(-PARAM_REGGE::b_OREAR * msqrt(std::abs(tprime) + pow2(PARAM_REGGE::a_OREAR)) +
+                      PARAM_REGGE::a_OREAR * PARAM_REGGE::b_OREAR);
+    default:  // POW
+      return 1.0 / (1.0 - tprime / PARAM_REGGE::b_POW);
   }
 }
 
+double Meson_FF(double t_hat, double M2) { return OffShell_FF(t_hat - M2); }
+
+// Off-Shell baryon form factor
+double Baryon_FF(double t_hat, double M2) { return OffShell_FF(t_hat - M2); }
+
 // Off-shell meson M* propagator
-double Meson_prop(double t_hat, double M2) {
-  double val = 1.0 / (t_hat - M2);
-  if (PARAM_REGGE::reggeize) {
-    //"Reggeization" ~ s^J(t) (NOT IMPLEMENTED, return without)
-    return val;
-  } else {
-    return val;
-  }
-}
+//"Reggeization" ~ s^J(t) (NOT IMPLEMENTED, the reggeize flag has no effect)
+double Meson_prop(double t_hat, double M2) { return 1.0 / (t_hat - M2); }
 
 // Off-shell baryon B* propagator
-double Baryon_prop(double t_hat, double M2) {
-  double val = 1.0 / (t_hat - M2);
-  if (PARAM_REGGE::reggeize) {
-    //"Reggeization" ~ s^J(t) (NOT IMPLEMENTED, return without)
-    return val;
-  } else {
-    return val;
-  }
-}
+//"Reggeization" ~ s^J(t) (NOT IMPLEMENTED, the reggeize flag has no effect)
+double Baryon_prop(double t_hat, double M2) { return 1.0 / (t_hat - M2); }
 
 // Final State Interaction (FSI) kt^2 loop integral
 // NOT IMPLEMENTED
@@ -1246,5 +1460,17 @@ double ResonanceFormFactor(double s_hat, double M2, double S0) {
   return std::exp(-pow2(s_hat - M2) / math::pow4(S0));
 }
 
+// Cached version: M^2 and 1/S0^4 depend only on the resonance parameters,
+// which are fixed across events (but may be re-tuned between runs)
+double ResonanceFormFactor(double s_hat, const gra::PARAM_RES &resonance) {
+  if (resonance.p.mass != resonance.ff_mass || resonance.g_FF != resonance.ff_S0) {
+    resonance.ff_mass    = resonance.p.mass;
+    resonance.ff_S0      = resonance.g_FF;
+    resonance.ff_M2      = pow2(resonance.p.mass);
+    resonance.ff_inv_S04 = 1.0 / math::pow4(resonance.g_FF);
+  }
+  return std::exp(-pow2(s_hat - resonance.ff_M2) * resonance.ff_inv_S04);
+}
+
 }  // namespace PARAM_REGGE
 }  // namespace gra
@@ -33,6 +33,82 @@ namespace spherical {
 // is flat (uniform). In a geometrically restricted phase space, these basis
 // functions get mixed => lost orthogonality.
 
+// Normalization constants K_lm (event independent), index [l*(LMAX+1) + m], m >= 0
+static std::vector<double> YlmNormTable(int LMAX) {
+  const int           NL = LMAX + 1;
+  std::vector<double> K(NL * NL, 0.0);
+  for (int l = 0; l <= LMAX; ++l) {
+    for (int m = 0; m <= l; ++m) {
+      K[l * NL + m] = msqrt(((2.0 * l + 1.0) * gra::math::factorial(l - m)) /
+                            (4.0 * PI * gra::math::factorial(l + m)));
+    }
+  }
+  return K;
+}
+
+// Evaluate all (LMAX+1)^2 real-basis Y_lm values of one (costheta, phi)
+// point into y, indexed by LinearInd(l,m).
+//
+// Associated Legendre P_l^m by the standard three-term recurrence (each
+// (l,m) computed once) and cos(m phi) / sin(m phi) by the Chebyshev
+// recurrence from a single sincos. Numerically identical to
+// NReY(Y_complex_basis(...)) per construction. K is the YlmNormTable,
+// P/cmphi/smphi are caller-provided work buffers (reused across events).
+static void EvalRealYlm(double costheta, double phi, int LMAX, const std::vector<double> &K,
+                        std::vector<double> &P, std::vector<double> &cmphi,
+                        std::vector<double> &smphi, double *y) {
+  const int NL = LMAX + 1;
+
+  // cos(m phi), sin(m phi) by the Chebyshev recurrence
+  cmphi[0] = 1.0;
+  smphi[0] = 0.0;
+  if (LMAX >= 1) {
+    gra::math::msincos(phi, smphi[1], cmphi[1]);
+    for (int m = 2; m <= LMAX; ++m) {
+      cmphi[m] = 2.0 * cmphi[1] * cmphi[m - 1] - cmphi[m - 2];
+      smphi[m] = 2.0 * cmphi[1] * smphi[m - 1] - smphi[m - 2];
+    }
+  }
+
+  // Associated Legendre values: diagonal P_m^m, then upward in l
+  const double sx2 = msqrt((1.0 - costheta) * (1.0 + costheta));
+  double       pmm = 1.0;
+  for (int m = 0; m <= LMAX; ++m) {
+    P[m * NL + m] = pmm;
+    if (m < LMAX) {
+      const double pmmp1  = costheta * (2.0 * m + 1.0) * pmm;
+      P[(m + 1) * NL + m] = pmmp1;
+      double plm1         = pmm;
+      double pl           = pmmp1;
+      for (int l = m + 2; l <= LMAX; ++l) {
+        const double pll = ((2.0 * l - 1.0) * costheta * pl - (l + m - 1.0) * plm1) / (l - m);
+        P[l * NL + m]    = pll;
+        plm1             = pl;
+        pl               = pll;
+      }
+    }
+    pmm *= -(2.0 * m + 1.0) * sx2;
+  }
+
+  // Assemble the real basis values
+  const double sqrt2 = msqrt(2.0);
+  for (int l = 0; l <= LMAX; ++l) {
+    for (int m = -l; m <= l; ++m) {
+      const int    index = LinearInd(l, m);
+      const int    ma    = std::abs(m);
+      const double KP    = K[l * NL + ma] * P[l * NL + ma];
+
+      if (m > 0) {
+        y[index] = ((ma % 2) ? -1.0 : 1.0) * sqrt2 * KP * cmphi[ma];
+      } else if (m == 0) {
+        y[index] = KP;
+      } else {
+        y[index] = -sqrt2 * KP * smphi[ma];
+      }
+    }
+  }
+}
+
 MMatrix<double> GetGMixing(const std::vector<Omega> &events, const std::vector<std::size_t> &ind,
                            int LMAX, const std::string &mode) {
   const int NCOEF = (LMAX + 1) * (LMAX + 1);
@@ -55,6 +131,15 @@ MMatrix<double> GetGMixing(const std::vector<Omega> &events, const std::vector<s
 
   const double VOL = 4.0 * PI;  // [costheta] x [phi] plane area
 
+  // Event independent normalization constants and per-event recurrence
+  // work buffers (hoisted out of the event loop)
+  const int                 NL = LMAX + 1;
+  const std::vector<double> K  = YlmNormTable(LMAX);
+  std::vector<double>       P(NL * NL, 0.0);
+  std::vector<double>       cmphi(NL, 0.0);
+  std::vector<double>       smphi(NL, 0.0);
+  std::vector<double>       y(NCOEF, 0.0);
+
   for (const auto &k : ind) {
     const bool fid = events[k].fiducial;
     const bool sel = events[k].selected;
@@ -87,30 +172,21 @@ MMatrix<double> GetGMixing(const std::vector<Omega> &events, const std::vector<s
       throw std::invalid_argument("spherical::GetELM: Unknown mode " + mode);
     }
 
-    const double costheta = events[k].costheta;
-    const double phi      = events[k].phi;
-
-    for (int l = 0; l <= LMAX; ++l) {
-      for (int m = -l; m <= l; ++m) {
-        const int index = LinearInd(l, m);
-
-        const std::complex<double> Y   = gra::math::Y_complex_basis(costheta, phi, l, m);
-        const double               ReY = gra::math::NReY(Y, l, m);
-
-        for (int lprime = 0; lprime <= LMAX; ++lprime) {
-          for (int mprime = -lprime; mprime <= lprime; ++mprime) {
-            const int                  indexprime = LinearInd(lprime, mprime);
-            const std::complex<double> Yprime =
-                gra::math::Y_complex_basis(costheta, phi, lprime, mprime);
-            const double ReYprime = gra::math::NReY(Yprime, lprime, mprime);
-
-            // Sum to the MC integral and its squared version
-            // (for uncertainty)
-            const double f = VOL * ReY * ReYprime;  // Note volume term
-            E[index][indexprime] += f;
-            E2[index][indexprime] += f * f;
-          }
-        }
+    // Evaluate the NCOEF harmonic values once for this event; the old
+    // quadruple loop recomputed Y for both the row and the column index,
+    // i.e. O(NCOEF^2) basis evaluations per event instead of O(NCOEF)
+    EvalRealYlm(events[k].costheta, events[k].phi, LMAX, K, P, cmphi, smphi, y.data());
+
+    // Rank-1 update E += VOL*y*y^T over the contiguous row-major rows
+    for (int index = 0; index < NCOEF; ++index) {
+      const double  yi     = VOL * y[index];
+      double *      E_row  = E[index];
+      double *      E2_row = E2[index];
+      for (int indexprime = 0; indexprime < NCOEF; ++indexprime) {
+        // Sum to the MC integral and its squared version (for uncertainty)
+        const double f = yi * y[indexprime];  // Note volume term in yi
+        E_row[indexprime] += f;
+        E2_row[indexprime] += f * f;
       }
     }
   }
@@ -224,6 +300,15 @@ std::pair<std::vector<double>, std::vector<double>> GetELM(const std::vector<Ome
   int          selected = 0;
   const double V        = sqrt(4.0 * PI);  // Normalization volume
 
+  // Event independent normalization constants and per-event recurrence
+  // work buffers (hoisted out of the event loop)
+  const int                 NL = LMAX + 1;
+  const std::vector<double> K  = YlmNormTable(LMAX);
+  std::vector<double>       P(NL * NL, 0.0);
+  std::vector<double>       cmphi(NL, 0.0);
+  std::vector<double>       smphi(NL, 0.0);
+  std::vector<double>       y(NCOEF, 0.0);
+
   for (const auto &k : ind) {
     bool fid = MC[k].fiducial;
     bool sel = MC[k].selected;
@@ -256,20 +341,15 @@ std::pair<std::vector<double>, std::vector<double>> GetELM(const std::vector<Ome
       throw std::invalid_argument("spherical::GetELM: Unknown mode " + mode);
     }
 
-    const double costheta = MC[k].costheta;
-    const double phi      = MC[k].phi;
-
-    for (int l = 0; l <= LMAX; ++l) {
-      for (int m = -l; m <= l; ++m) {
-        const std::complex<double> Y = gra::math::Y_complex_basis(costheta, phi, l, m);
-
-        // Sum to the MC integral and its square (for uncertainty)
-        double f = V * gra::math::NReY(Y, l, m);  // Note volume V term
+    // Evaluate the full harmonic vector of this event once via the
+    // recurrences, then accumulate the MC integral and its square (for
+    // uncertainty) in one fused sweep over the coefficients
+    EvalRealYlm(MC[k].costheta, MC[k].phi, LMAX, K, P, cmphi, smphi, y.data());
 
-        const int index = LinearInd(l, m);
-        E[index] += f;
-        E2[index] += pow2(f);
-      }
+    for (int index = 0; index < NCOEF; ++index) {
+      const double f = V * y[index];  // Note volume V term
+      E[index] += f;
+      E2[index] += f * f;
     }
   }
   if (mode == "fid" || mode == "det") {
@@ -375,28 +455,30 @@ std::vector<double> SphericalMoments(const std::vector<Omega> &      input,
 }
 
 // Calculate Y_lm values for each event
+//
+// Evaluated directly in the real basis via the standard recurrences:
+// associated Legendre P_l^m by the three-term recurrence (each (l,m)
+// computed once per event, not rebuilt from the diagonal per call) and
+// cos(m phi) / sin(m phi) by the Chebyshev recurrence from one sincos.
+// Numerically identical to NReY(Y_complex_basis(...)) per construction.
 MMatrix<double> YLM(const std::vector<Omega> &events, int LMAX) {
   std::cout << "YLM:" << std::endl;
 
-  const unsigned int NCOEFF = (LMAX + 1) * (LMAX + 1);
+  const int          NL     = LMAX + 1;
+  const unsigned int NCOEFF = NL * NL;
   MMatrix<double>    Y_lm(events.size(), NCOEFF, 0.0);
 
-  // Loop over events
-  for (const auto &k : indices(events)) {
-    // Get event (costheta, phi)
-    const double costheta = events[k].costheta;
-    const double phi      = events[k].phi;
-
-    // Loop over (l,m) coefficients
-    for (int l = 0; l <= LMAX; ++l) {
-      for (int m = -l; m <= l; ++m) {
-        const std::complex<double> Y = gra::math::Y_complex_basis(costheta, phi, l, m);
+  // Event independent normalization constants and per-event recurrence
+  // work buffers
+  const std::vector<double> K = YlmNormTable(LMAX);
+  std::vector<double>       P(NL * NL, 0.0);  // P_l^m, index [l*NL + m], m >= 0
+  std::vector<double>       cmphi(NL, 0.0);   // cos(m phi)
+  std::vector<double>       smphi(NL, 0.0);   // sin(m phi)
 
-        // Save its value
-        const int index = LinearInd(l, m);
-        Y_lm[k][index]  = gra::math::NReY(Y, l, m);
-      }
-    }
+  // Loop over events, writing each harmonic vector directly into the
+  // contiguous row of the output matrix
+  for (const auto &k : indices(events)) {
+    EvalRealYlm(events[k].costheta, events[k].phi, LMAX, K, P, cmphi, smphi, Y_lm[k]);
   }
   return Y_lm;
 }
@@ -461,6 +543,42 @@ std::vector<std::size_t> GetIndices(const std::vector<Omega> &events, const std:
   return ind;
 }
 
+// Calculate indices for this interval (SoA event stream)
+//
+// Same selection as the AoS version above, but evaluated as a branch-free
+// mask sweep over the contiguous M/Pt/Y arrays followed by index compaction.
+std::vector<std::size_t> GetIndices(const OmegaSoA &events, const std::vector<double> &M,
+                                    const std::vector<double> &Pt, const std::vector<double> &Y) {
+  const std::size_t    N = events.size();
+  std::vector<uint8_t> mask(N, 0);
+
+  for (std::size_t i = 0; i < N; ++i) {
+    mask[i] = (events.M[i] > M[0]) & (events.M[i] < M[1]);
+  }
+  for (std::size_t i = 0; i < N; ++i) {
+    mask[i] &= (events.Pt[i] > Pt[0]) & (events.Pt[i] < Pt[1]);
+  }
+  for (std::size_t i = 0; i < N; ++i) {
+    mask[i] &= (events.Y[i] > Y[0]) & (events.Y[i] < Y[1]);
+  }
+
+  std::vector<std::size_t> ind;
+  for (std::size_t i = 0; i < N; ++i) {
+    if (mask[i]) { ind.push_back(i); }
+  }
+
+  gra::aux::PrintBar("-");
+  std::cout << rang::fg::green;
+  printf(
+      "MASS RANGE: [%0.3f, %0.3f] GeV, PT RANGE: [%0.3f, %0.3f] GeV, Y "
+      "RANGE: [%0.3f, %0.3f] "
+      ": Events in this hyperbin %lu/%lu \n\n",
+      M[0], M[1], Pt[0], Pt[1], Y[0], Y[1], ind.size(), N);
+  std::cout << rang::fg::reset;
+
+  return ind;
+}
+
 // TestIntegrals spherical harmonics
 // This is a test function, all integrals should give 1 if the normalization is
 // correct
@@ -514,9 +632,6 @@ void TestSphericalIntegrals(int LMAX) {
   std::cout << std::endl;
 }
 
-// Find out linear index
-int LinearInd(int l, int m) { return l * (l + 1) + m; }
-
 // Standard error
 double CalcError(double f2, double f, double N) { return sqrt((f2 - std::pow(f, 2)) / N); }
 
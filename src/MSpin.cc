@@ -17,9 +17,12 @@
 
 // C++ standard
 #include <algorithm>
+#include <bitset>
 #include <complex>
+#include <cstdint>
 #include <iostream>
 #include <random>
+#include <unordered_map>
 #include <vector>
 
 // Eigen
@@ -73,8 +76,10 @@ void InitTMatrix(gra::HELMatrix &hc, const gra::MParticle &p, const gra::MPartic
   hc.T = MMatrix<std::complex<double>>(static_cast<unsigned int>(2 * s1 + 1),
                                        static_cast<unsigned int>(2 * s2 + 1), 0.0);
 
-  MMatrix<bool> need_to_set(20, 20, false);
-  MMatrix<bool> active(20, 20, false);
+  // (l,s)-flags packed as bits [l * MAXLS + s], no heap allocation
+  constexpr unsigned int        MAXLS = 20;
+  std::bitset<MAXLS * MAXLS>    need_to_set;
+  std::bitset<MAXLS * MAXLS>    active;
 
   bool         tag_set = false;
   unsigned int nonzero = 0;
@@ -110,6 +115,16 @@ void InitTMatrix(gra::HELMatrix &hc, const gra::MParticle &p, const gra::MPartic
   for (int MODE = 0; MODE < 2; ++MODE) {
     for (int s = 0; s <= static_cast<int>(s1 + s2); ++s) {
       for (int l = 0; l <= static_cast<int>(J + s); ++l) {
+        // If parity conserving decay: the parity of the final state
+        // (holds for both bosons/fermions) depends only on l
+        if (hc.P_conservation) {
+          const int P_tot = P1 * P2 * ((l % 2 == 0) ? 1 : -1);
+          if (P_tot != P) { continue; }  // not conserved
+        }
+
+        // Normalization
+        const double NORM = msqrt((2.0 * l + 1.0) / (2.0 * J + 1.0));
+
         for (int i = 0; i < static_cast<int>(2 * s1 + 1); ++i) {
           for (int j = 0; j < static_cast<int>(2 * s2 + 1); ++j) {
             const double lambda1 = -s1 + static_cast<double>(i);  // From negative to positive
@@ -124,9 +139,6 @@ void InitTMatrix(gra::HELMatrix &hc, const gra::MParticle &p, const gra::MPartic
             // -------------------------------------------------------------
             // Re-coupling coefficients << ... >>
 
-            // Normalization
-            const double NORM = msqrt((2.0 * l + 1.0) / (2.0 * J + 1.0));
-
             // <J \lambda | ls0\lambda>
             const double cg1 = gra::spin::ClebschGordan(
                 static_cast<double>(l), static_cast<double>(s), 0.0, lambda, J, lambda);
@@ -140,14 +152,6 @@ void InitTMatrix(gra::HELMatrix &hc, const gra::MParticle &p, const gra::MPartic
             // Angular momentum conserved (should be, by construction here)
             if (!(std::abs(lambda) <= J)) { continue; }  // not conserved
 
-            // If parity conserving decay
-            if (hc.P_conservation) {
-              // Parity of the final state (hold for both
-              // bosons/fermions)
-              const int P_tot = P1 * P2 * std::pow(-1, l);
-              if (P_tot != P) { continue; }  // not conserved
-            }
-
             // Bose-Symmetry for identical Boson-Pairs (symmetric
             // wavefunction)
             if (is_boson1 && is_boson2 && identical) {
@@ -164,15 +168,15 @@ void InitTMatrix(gra::HELMatrix &hc, const gra::MParticle &p, const gra::MPartic
             if (std::abs(cg1 * cg2) < 1e-6) { continue; }  // is negligible
 
             // ** This coefficient is active **
-            active[l][s] = true;
+            active.set(l * MAXLS + s);
 
 
             // INITIALIZATION MODE
             if (MODE == 0) {
               // Has not been set, throw error next
               if (hc.alpha_set[l][s] == false) {
-                need_to_set[l][s] = true;
-                tag_set           = true;
+                need_to_set.set(l * MAXLS + s);
+                tag_set = true;
               }
               ++nonzero;
             }
@@ -199,7 +203,7 @@ void InitTMatrix(gra::HELMatrix &hc, const gra::MParticle &p, const gra::MPartic
     if (MODE == 0) {
       for (std::size_t l = 0; l < hc.alpha.size_row(); ++l) {
         for (std::size_t s = 0; s < hc.alpha.size_col(); ++s) {
-          if (active[l][s] == true) { sum_alphasq += math::abs2(hc.alpha[l][s]); }
+          if (active.test(l * MAXLS + s)) { sum_alphasq += math::abs2(hc.alpha[l][s]); }
         }
       }
     }
@@ -212,7 +216,7 @@ void InitTMatrix(gra::HELMatrix &hc, const gra::MParticle &p, const gra::MPartic
 
       for (std::size_t l = 0; l < hc.alpha.size_row(); ++l) {
         for (std::size_t s = 0; s < hc.alpha.size_col(); ++s) {
-          if (active[l][s]) { hc.alpha[l][s] /= msqrt(sum_alphasq); }
+          if (active.test(l * MAXLS + s)) { hc.alpha[l][s] /= msqrt(sum_alphasq); }
         }
       }
     }
@@ -238,7 +242,7 @@ void InitTMatrix(gra::HELMatrix &hc, const gra::MParticle &p, const gra::MPartic
   // Nullify all inactive
   for (std::size_t l = 0; l < hc.alpha.size_row(); ++l) {
     for (std::size_t s = 0; s < hc.alpha.size_col(); ++s) {
-      if (active[l][s] == false) { hc.alpha[l][s] = 0.0; }
+      if (!active.test(l * MAXLS + s)) { hc.alpha[l][s] = 0.0; }
     }
   }
 
@@ -250,9 +254,9 @@ void InitTMatrix(gra::HELMatrix &hc, const gra::MParticle &p, const gra::MPartic
   // Check do have missing values:
   if (tag_set) {
     std::string str = "";
-    for (std::size_t l = 0; l < need_to_set.size_row(); ++l) {
-      for (std::size_t s = 0; s < need_to_set.size_col(); ++s) {
-        if (need_to_set[l][s] == true) {
+    for (std::size_t l = 0; l < MAXLS; ++l) {
+      for (std::size_t s = 0; s < MAXLS; ++s) {
+        if (need_to_set.test(l * MAXLS + s)) {
           str += "(" + std::to_string(l) + "," + std::to_string(s) + ") ";
         }
       }
@@ -272,20 +276,44 @@ void InitTMatrix(gra::HELMatrix &hc, const gra::MParticle &p, const gra::MPartic
 //
 // Bose-Einstein statistics requires l-s to be even
 // for identical Boson pairs.
-bool BoseSymmetry(int l, int s) {
-  const int number = l - s;
-  if (number % 2 == 0) { return true; }
-  return false;
-}
+bool BoseSymmetry(int l, int s) { return ((l ^ s) & 1) == 0; }
 
 // Fermi-Dirac statistics requires l+s to be even
 // for identical Fermion pairs.
-bool FermiSymmetry(int l, int s) {
-  const int number = l + s;
-  if (number % 2 == 0) { return true; }
-  return false;
+// N.B. l+s and l-s have the same parity, so the check is the same
+bool FermiSymmetry(int l, int s) { return BoseSymmetry(l, s); }
+
+
+// Tr[f * rho * f^dagger] without materializing the matrix products
+//
+// The contraction runs in the same order as the two matrix products
+// followed by Trace(), so the result is bit-identical
+static std::complex<double> TraceFRhoFdag(const MMatrix<std::complex<double>> &f,
+                                          const MMatrix<std::complex<double>> &rho) {
+  std::complex<double> trace = 0.0;
+  for (std::size_t i = 0; i < f.size_row(); ++i) {
+    std::complex<double> diag = 0.0;
+    for (std::size_t l = 0; l < f.size_col(); ++l) {
+      // (f * rho)[i][l]
+      std::complex<double> G = 0.0;
+      for (std::size_t k = 0; k < f.size_col(); ++k) { G += f[i][k] * rho[k][l]; }
+      diag += G * std::conj(f[i][l]);
+    }
+    trace += diag;
+  }
+  return trace;
 }
 
+// Tr[f * f^dagger] without materializing the product
+static std::complex<double> TraceFFdag(const MMatrix<std::complex<double>> &f) {
+  std::complex<double> trace = 0.0;
+  for (std::size_t i = 0; i < f.size_row(); ++i) {
+    std::complex<double> diag = 0.0;
+    for (std::size_t l = 0; l < f.size_col(); ++l) { diag += f[i][l] * std::conj(f[i][l]); }
+    trace += diag;
+  }
+  return trace;
+}
 
 // Initial state spin treatment: Pomeron + Pomeron/Gamma -> Resonance X
 //
@@ -341,6 +369,10 @@ std::complex<double> ProdAmp(const gra::LORENTZSCALAR &lts, gra::PARAM_RES &res)
 
     // See Kaidalov et al.
     auto ReggeTheory = [](double t1, double t2, double m1, double m2) {
+      // |m| = 1 (the case fixed above) reduces |t|^(|m|/2) to a square root
+      if (std::abs(m1) == 1 && std::abs(m2) == 1) {
+        return std::sqrt(std::abs(t1)) * std::sqrt(std::abs(t2));
+      }
       return std::pow(std::abs(t1), std::abs(m1) / 2.0) *
              std::pow(std::abs(t2), std::abs(m2) / 2.0);
     };
@@ -437,14 +469,12 @@ std::complex<double> ProdAmp(const gra::LORENTZSCALAR &lts, gra::PARAM_RES &res)
   // rho_rot = D^\dagger*rho*D [keep this sandwich order!]
   const MMatrix<std::complex<double>> rho_ROT = D.Dagger() * res.rho * D;
 
-  // Krauss operator map
-  const MMatrix<std::complex<double>> f0Rfd0 = f0 * rho_ROT * f0.Dagger();
-
   // Normalization as in DecayAmp
   const double NORM = msqrt(res.p.spinX2 + 1.0);
 
-  // Apply final amplitude level weight
-  A0 *= NORM * msqrt(std::real(f0Rfd0.Trace()));
+  // Apply final amplitude level weight via the Krauss operator map
+  // trace Tr[f0 * rho_ROT * f0^dagger]
+  A0 *= NORM * msqrt(std::real(TraceFRhoFdag(f0, rho_ROT)));
 
   return A0;
 }
@@ -559,11 +589,11 @@ std::complex<double> DecayAmp(gra::LORENTZSCALAR &lts, gra::PARAM_RES &res) {
   // ------------------------------------------------------------------
   // 3. Rotation does mixing of spin states. N.B. Eigenvalues do not change in
   // rotation.
-  MMatrix<std::complex<double>> fRfd;
+  std::complex<double> trFRF = 0.0;
 
   if (res.p.spinX2 == 0) {
     // X == Scalar 0+ or Pseudoscalar 0^- will end up here
-    fRfd = f * f.Dagger();
+    trFRF = TraceFFdag(f);
 
   } else {
 
@@ -581,7 +611,7 @@ std::complex<double> DecayAmp(gra::LORENTZSCALAR &lts, gra::PARAM_RES &res) {
 
     // Weight (amplitude squared) of the event by the density matrix formalism:
     // Tr[f*rho*f^dagger]
-    fRfd = f * rho_ROT * f.Dagger();
+    trFRF = TraceFRhoFdag(f, rho_ROT);
   }
 
   // (2J+1) is normalization to match production coupling with spin-0
@@ -590,7 +620,7 @@ std::complex<double> DecayAmp(gra::LORENTZSCALAR &lts, gra::PARAM_RES &res) {
   const double NORM = msqrt(res.p.spinX2 + 1.0);
 
   // Final weight at amplitude level
-  A0 *= NORM * msqrt(std::real(fRfd.Trace()));
+  A0 *= NORM * msqrt(std::real(trFRF));
 
   return A0;
 }
@@ -721,9 +751,10 @@ void get_ijk_amplitude(const MDecayBranch& i, const MDecayBranch& j, const MDeca
     amplitude = i.f * k.f;
     name      = "(" + i.name + " " + k.name + ")";
 
-  // Both legs have daughters
+  // Both legs have daughters: fused (i.f (x) j.f) * k.f without
+  // materializing the Kronecker matrix
   } else {
-    amplitude = gra::matoper::TensorProd(i.f, j.f) * k.f;
+    amplitude = gra::matoper::KronMul(i.f, j.f, k.f);
     name      = "[(" + i.name + " (kron) " + j.name + ") " + k.name + "]";
   }
   return;
@@ -980,8 +1011,23 @@ double ClebschGordan(double j1, double j2, double m1, double m2, double j, doubl
   // Selection rules
   if (!CGrules(j1, j2, m1, m2, j, m)) { return 0.0; }
 
+  // Memoize on the doubled (half-integer) arguments packed into one key;
+  // the same few coefficients are re-evaluated heavily, e.g. by the
+  // spin-2 polarization tensor decomposition and the T-matrix loops
+  auto pack = [](double x) {
+    return static_cast<uint64_t>(std::lround(2.0 * x)) & 0xFF;
+  };
+  const uint64_t key = (pack(j1) << 40) | (pack(j2) << 32) | (pack(m1) << 24) | (pack(m2) << 16) |
+                       (pack(j) << 8) | pack(m);
+
+  static thread_local std::unordered_map<uint64_t, double> cache;
+  const auto it = cache.find(key);
+  if (it != cache.end()) { return it->second; }
+
   // Use Wigner-3j symbol to evaluate, note minus on m!
-  return std::pow(-1.0, m + j1 - j2) * msqrt(2 * j + 1) * W3j(j1, j2, j, m1, m2, -m);
+  const double value = std::pow(-1.0, m + j1 - j2) * msqrt(2 * j + 1) * W3j(j1, j2, j, m1, m2, -m);
+  cache.emplace(key, value);
+  return value;
 }
 
 // Check if half-integer
@@ -1089,13 +1135,18 @@ double W3j(double j1, double j2, double j3, double m1, double m2, double m3) {
 
   // Evaluate sum term
   for (int k = lower; k <= upper; ++k) {
-    fsum += std::pow(-1.0, k) / (gra::math::factorial(k) * gra::math::factorial(c1 + k) *
-                                 gra::math::factorial(c2 + k) * gra::math::factorial(c3 - k) *
-                                 gra::math::factorial(c4 - k) * gra::math::factorial(c5 - k));
+    const double sgn = ((k % 2 == 0) ? 1.0 : -1.0);  // (-1)^k
+    fsum += sgn / (gra::math::factorial(k) * gra::math::factorial(c1 + k) *
+                   gra::math::factorial(c2 + k) * gra::math::factorial(c3 - k) *
+                   gra::math::factorial(c4 - k) * gra::math::factorial(c5 - k));
   }
 
+  // (-1)^(j1 - j2 - m3), the exponent is an integer by the selection rules
+  const int    e123   = static_cast<int>(std::lround(j1 - j2 - m3));
+  const double phase  = ((e123 % 2 == 0) ? 1.0 : -1.0);
+
   // Evaluate by Racah formula
-  const double wc = std::pow(-1.0, j1 - j2 - m3) *
+  const double wc = phase *
                     msqrt(TriangleCoeff(j1, j2, j3) * gra::math::factorial(j1 + m1) *
                           gra::math::factorial(j1 - m1) * gra::math::factorial(j2 + m2) *
                           gra::math::factorial(j2 - m2) * gra::math::factorial(j3 + m3) *
@@ -19,37 +19,37 @@ namespace gra {
 
 
 // Add all processes
-std::vector<std::shared_ptr<MProc>> MSubProc::CreateAllProcesses() const {
-  std::vector<std::shared_ptr<MProc>> v;
-
-  v.push_back(std::shared_ptr<MProc>{new PROC_0()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_1()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_2()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_3()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_4()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_5()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_6()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_7()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_8()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_9()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_10()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_11()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_12()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_13()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_14()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_15()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_16()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_17()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_18()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_19()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_20()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_21()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_22()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_23()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_24()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_25()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_26()});
-  v.push_back(std::shared_ptr<MProc>{new PROC_27()});
+std::vector<ProcessVariant> MSubProc::CreateAllProcesses() const {
+  std::vector<ProcessVariant> v;
+
+  v.push_back(PROC_0());
+  v.push_back(PROC_1());
+  v.push_back(PROC_2());
+  v.push_back(PROC_3());
+  v.push_back(PROC_4());
+  v.push_back(PROC_5());
+  v.push_back(PROC_6());
+  v.push_back(PROC_7());
+  v.push_back(PROC_8());
+  v.push_back(PROC_9());
+  v.push_back(PROC_10());
+  v.push_back(PROC_11());
+  v.push_back(PROC_12());
+  v.push_back(PROC_13());
+  v.push_back(PROC_14());
+  v.push_back(PROC_15());
+  v.push_back(PROC_16());
+  v.push_back(PROC_17());
+  v.push_back(PROC_18());
+  v.push_back(PROC_19());
+  v.push_back(PROC_20());
+  v.push_back(PROC_21());
+  v.push_back(PROC_22());
+  v.push_back(PROC_23());
+  v.push_back(PROC_24());
+  v.push_back(PROC_25());
+  v.push_back(PROC_26());
+  v.push_back(PROC_27());
 
   return v;
 }
@@ -65,92 +65,116 @@ MSubProc::MSubProc(const std::vector<std::string>& istate, const std::string& mc
 void MSubProc::Initialize(const std::string& istate, const std::string& channel) {
   ISTATE  = istate;
   CHANNEL = channel;
+
+  // Activate eagerly when the pair is known, so the first event does not
+  // pay for it; an unknown pair is reported later with the full process
+  // string by MProcess::SetProcess
+  TryActivateProcess();
 }
 
 
 // Construct textual descriptions
 void MSubProc::ConstructDescriptions(const std::string& istate, const std::string& mc) {
-  const std::vector<std::shared_ptr<MProc>> p = CreateAllProcesses();
+  const std::vector<ProcessVariant> p = CreateAllProcesses();
 
   for (const auto& i : aux::indices(p)) {
-    if (p[i]->ISTATE == istate) {
-      Processes.insert(
-          std::make_pair(p[i]->ISTATE + "[" + p[i]->CHANNEL + "]<" + mc + ">", p[i]->DESCRIPTION));
+    const MProc& base = ProcessBase(p[i]);
+    if (base.ISTATE == istate) {
+      Processes.push_back(
+          std::make_pair(base.ISTATE + "[" + base.CHANNEL + "]<" + mc + ">", base.DESCRIPTION));
     }
   }
+  // Keep the flat table sorted by name for binary search lookups
+  std::sort(Processes.begin(), Processes.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
 }
 
+// Binary search the sorted process table, returns end() if not found
+MSubProc::ProcessTable::const_iterator MSubProc::FindProcess(const std::string& process) const {
+  const auto it =
+      std::lower_bound(Processes.begin(), Processes.end(), process,
+                       [](const auto& entry, const std::string& key) { return entry.first < key; });
+  if (it != Processes.end() && it->first == process) { return it; }
+  return Processes.end();
+}
 
-// Activate spesific process
-void MSubProc::ActivateProcess() {
-  std::vector<std::shared_ptr<MProc>> p = CreateAllProcesses();
-
-  while (true) {
-    for (const auto& i : aux::indices(p)) {
-      if (p[i]->ISTATE == ISTATE && p[i]->CHANNEL == CHANNEL) {
-        // Fine
-      } else {
-        p.erase(p.begin() + i);
-        break;
-      }
+
+// Activate spesific process, if the (ISTATE, CHANNEL) pair exists
+bool MSubProc::TryActivateProcess() {
+  std::vector<ProcessVariant> p = CreateAllProcesses();
+
+  for (auto& proc : p) {
+    const MProc& base = ProcessBase(proc);
+    if (base.ISTATE == ISTATE && base.CHANNEL == CHANNEL) {
+      // move it!
+      pr = std::move(proc);
+      return true;
     }
-    if (p.size() <= 1) { break; }
   }
-  if (p.size() == 0) {
+  return false;
+}
+
+// Activate spesific process
+void MSubProc::ActivateProcess() {
+  if (!TryActivateProcess()) {
     throw std::invalid_argument("MSubProc::ActivateProcess: Unknown ISTATE = " + ISTATE +
                                 " or CHANNEL = " + CHANNEL);
   }
-
-  // move it!
-  pr = std::move(p[0]);
 }
 
 
 // Print out process lists
 std::vector<std::string> MSubProc::PrintProcesses() const {
-  // Iterate through processes
-  std::vector<std::string>                                        procstr;
-  std::map<std::string, std::vector<std::string>>::const_iterator it = Processes.begin();
-
-  while (it != Processes.end()) {
-    procstr.push_back(it->first);
-
-    if (it->second.size() == 0) {
-      printf("%25s  =      ", it->first.c_str());
-    } else if (it->second.size() == 1) {
-      printf("%25s  =  %-43s", it->first.c_str(), it->second[0].c_str());
-    } else if (it->second.size() == 2) {
-      printf("%25s  =  %-43s  |  %-20s", it->first.c_str(), it->second[0].c_str(),
-             it->second[1].c_str());
-    } else if (it->second.size() >= 3) {
-      printf("%25s  =  %-43s  |  %-20s  | %-10s", it->first.c_str(), it->second[0].c_str(),
-             it->second[1].c_str(), it->second[2].c_str());
+  // Iterate through processes (table is sorted by name)
+  std::vector<std::string> procstr;
+
+  for (const auto& proc : Processes) {
+    procstr.push_back(proc.first);
+
+    if (proc.second.size() == 0) {
+      printf("%25s  =      ", proc.first.c_str());
+    } else if (proc.second.size() == 1) {
+      printf("%25s  =  %-43s", proc.first.c_str(), proc.second[0].c_str());
+    } else if (proc.second.size() == 2) {
+      printf("%25s  =  %-43s  |  %-20s", proc.first.c_str(), proc.second[0].c_str(),
+             proc.second[1].c_str());
+    } else if (proc.second.size() >= 3) {
+      printf("%25s  =  %-43s  |  %-20s  | %-10s", proc.first.c_str(), proc.second[0].c_str(),
+             proc.second[1].c_str(), proc.second[2].c_str());
     }
     std::cout << "\n";
-    ++it;
   }
   return procstr;
 }
 
 // Check if process exists
-bool MSubProc::ProcessExist(std::string str) const {
-  if (Processes.find(str) != Processes.end()) { return true; }
-  return false;
-}
+bool MSubProc::ProcessExist(std::string str) const { return FindProcess(str) != Processes.end(); }
 
 // Return process description string
 std::vector<std::string> MSubProc::GetProcessDescriptor(std::string str) const {
-  if (!ProcessExist(str)) {
+  const auto it = FindProcess(str);
+  if (it == Processes.end()) {
     throw std::invalid_argument("MSubProc::GetProcessDescriptor: Process by name " + str +
                                 " does not exist");
   }
-  return Processes.find(str)->second;
+  return it->second;
 }
 
 // Wrapper function
 double MSubProc::GetBareAmplitude2(gra::LORENTZSCALAR& lts) {
-  if (pr == nullptr) { ActivateProcess(); }
-  return pr->Amp2(lts);
+  if (std::holds_alternative<std::monostate>(pr)) { ActivateProcess(); }
+
+  // Static dispatch over the closed process set; each Amp2 body is small
+  // enough to be inlined into the visitor
+  return std::visit(
+      [&lts](auto& proc) -> double {
+        if constexpr (std::is_same_v<std::decay_t<decltype(proc)>, std::monostate>) {
+          throw std::logic_error("MSubProc::GetBareAmplitude2: process not initialized");
+        } else {
+          return proc.Amp2(lts);
+        }
+      },
+      pr);
 }
 
 }  // namespace gra
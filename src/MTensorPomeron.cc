@@ -209,14 +209,14 @@ double MTensorPomeron::ME3(gra::LORENTZSCALAR &lts) const {
   // ------------------------------------------------------------------
 
   // Reset helicity amplitude container
-  // Init with zeros, important for the coherent sum!
-  lts.hamp             = std::vector<std::complex<double>>(64, 0.0);
+  // Init with zeros, important for the coherent sum! (capacity re-used)
+  lts.hamp.assign(64, 0.0);
   std::size_t maxindex = 0;
 
   // >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
   // 2. Coherent sum of Resonances (loop over)
   for (auto &x : lts.RESONANCES) {
-    const PARAM_RES res = x.second;
+    const PARAM_RES &res = x.second;  // no deep copy per resonance
 
     // Resonance parameters
     const double M0    = res.p.mass;
@@ -558,10 +558,15 @@ double MTensorPomeron::ME3(gra::LORENTZSCALAR &lts) const {
   // Remove empty
   lts.hamp.resize(maxindex);
 
-  // Get total amplitude squared 1/4 \sum_h |A_h|^2
+  // Get total amplitude squared 1/4 \sum_h |A_h|^2, modulus opened up so
+  // the reduction auto-vectorizes
   double SumAmp2 = 0.0;
-  for (const auto &i : indices(lts.hamp)) { SumAmp2 += gra::math::abs2(lts.hamp[i]); }
-  SumAmp2 /= 4;  // Initial state helicity average
+  for (const auto &i : indices(lts.hamp)) {
+    const double re = std::real(lts.hamp[i]);
+    const double im = std::imag(lts.hamp[i]);
+    SumAmp2 += re * re + im * im;
+  }
+  SumAmp2 *= 0.25;  // Initial state helicity average
 
 
   return SumAmp2;  // Amplitude squared
@@ -896,7 +901,7 @@ double MTensorPomeron::ME4(gra::LORENTZSCALAR &lts) const {
   // Get total amplitude squared 1/4 \sum_h |A_h|^2
   double SumAmp2 = 0.0;
   for (const auto &i : indices(lts.hamp)) { SumAmp2 += math::abs2(lts.hamp[i]); }
-  SumAmp2 /= 4;  // Initial state helicity average
+  SumAmp2 *= 0.25;  // Initial state helicity average
 
   return SumAmp2;  // Amplitude squared
 }
@@ -1113,7 +1118,7 @@ double MTensorPomeron::ME6(gra::LORENTZSCALAR &lts) const {
   // Get total amplitude squared 1/4 \sum_h |A_h|^2
   double SumAmp2 = 0.0;
   for (const auto &i : indices(lts.hamp)) { SumAmp2 += math::abs2(lts.hamp[i]); }
-  SumAmp2 /= 4;  // Initial state helicity average
+  SumAmp2 *= 0.25;  // Initial state helicity average
 
   // --------------------------------------------------------------------
   // *** CONTROL CASCADE SAMPLING ***
@@ -1350,12 +1355,15 @@ Tensor1<std::complex<double>, 4> MTensorPomeron::iG_ypp(
   const double e    = msqrt(qed::alpha_QED() * 4.0 * PI);  // ~ 0.3, no running
   const M4Vec  psum = prime - p;
 
+  // Loop-invariant form factors, one shared Sachs evaluation
+  const auto [F1_t, F2_t] = form::F1F2(t);
+
   Tensor1<std::complex<double>, 4> T;
   for (const auto &mu : LI) {
     MMatrix<std::complex<double>> SUM(4, 4, 0.0);
     for (const auto &nu : LI) { SUM += sigma_lo[mu][nu] * psum[nu]; }
-    const MMatrix<std::complex<double>> A = gamma_lo[mu] * F1(t);
-    const MMatrix<std::complex<double>> B = SUM * zi / (2 * PDG::mp) * F2(t);
+    const MMatrix<std::complex<double>> A = gamma_lo[mu] * F1_t;
+    const MMatrix<std::complex<double>> B = SUM * zi / (2 * PDG::mp) * F2_t;
     const MMatrix<std::complex<double>> G = (A + B) * (-zi * e);
 
     // \bar{spinor} [Gamma Matrix] \spinor product
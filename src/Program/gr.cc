@@ -48,6 +48,10 @@ int main(int argc, char *argv[]) {
     auto r = options.parse(argc, argv);
 
     if (r.count("help") || NARGC == 0) {
+      // Fire the online version query now; it downloads while the help
+      // text below is printed and is joined (with a timeout) at the end
+      auto update_future = aux::FireCheckUpdate();
+
       gen->GetProcessNumbers();
       std::cout << options.help({"", "GENERALPARAM", "PROCESSPARAM"}) << std::endl;
       std::cout << rang::style::bold << " Arrow operators:" << rang::style::reset << std::endl;
@@ -150,7 +154,7 @@ int main(int argc, char *argv[]) {
                 << std::endl
                 << std::endl;
 
-      aux::CheckUpdate();
+      aux::JoinCheckUpdate(update_future);
 
       return EXIT_FAILURE;
     }